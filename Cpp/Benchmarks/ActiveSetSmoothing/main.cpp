@@ -0,0 +1,201 @@
+/*
+Benchmark of active set basic smoothing for locally perturbed meshes.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Number of runs per configuration. The minimal smoothing time is reported.
+constexpr std::size_t numberOfRuns = 3;
+
+// Relocation distance threshold used to obtain converged meshes.
+constexpr double convergedRelocationDistanceThreshold = 1.0e-6;
+
+// Relocation distance threshold of the benchmarked smoothing runs.
+constexpr double maxNodeRelocationDistanceThreshold = 1.0e-3;
+
+// Run the given smoothing function repeatedly and return the result of the
+// last run together with the minimal smoothing time of all runs.
+std::pair<Smoothing::SmoothingResult, double> runRepeatedly(
+    const std::function<Smoothing::SmoothingResult()>& smoothingFunction) {
+  double minimalTime = std::numeric_limits<double>::infinity();
+  for (std::size_t run = 1; run < numberOfRuns; ++run) {
+    minimalTime = std::min(minimalTime,
+                           smoothingFunction().smoothingWallClockTimeInSeconds);
+  }
+  auto result = smoothingFunction();
+  minimalTime = std::min(minimalTime, result.smoothingWallClockTimeInSeconds);
+  return {std::move(result), minimalTime};
+}
+
+double getMeanEdgeLength(const Mesh::PolygonalMesh& mesh) {
+  const auto& nodes = mesh.getNodes();
+  double edgeLengthSum = 0.0;
+  std::size_t numberOfEdges = 0;
+  for (const auto& polygon : mesh.getPolygons()) {
+    for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
+         ++nodeNumber) {
+      edgeLengthSum += (nodes.at(polygon.getSuccessorNodeIndex(nodeNumber))
+                        - nodes.at(polygon.getNodeIndex(nodeNumber)))
+                           .getLength();
+      ++numberOfEdges;
+    }
+  }
+  return edgeLengthSum / static_cast<double>(numberOfEdges);
+}
+
+// Distort the non fixed nodes within a disk around the non fixed node closest
+// to the centroid of all nodes. All other nodes keep their position.
+Mesh::PolygonalMesh perturbLocally(const Mesh::PolygonalMesh& mesh) {
+  const auto& nodes = mesh.getNodes();
+  Mathematics::Vector2D centroid(0.0, 0.0);
+  for (const auto& node : nodes) {
+    centroid += node;
+  }
+  centroid /= static_cast<double>(nodes.size());
+  const auto& nonFixedNodeIndices = mesh.getNonFixedNodeIndices();
+  const auto centerNodeIndex = *std::min_element(
+      nonFixedNodeIndices.begin(), nonFixedNodeIndices.end(),
+      [&](const std::size_t first, const std::size_t second) {
+        return (nodes.at(first) - centroid).getLengthSquared()
+               < (nodes.at(second) - centroid).getLengthSquared();
+      });
+
+  const double meanEdgeLength = getMeanEdgeLength(mesh);
+  const double perturbationRadius = 3.0 * meanEdgeLength;
+  const double maxDistortionRadius = 0.3 * meanEdgeLength;
+  const std::uint64_t seed = 1;
+  const auto distortedMesh =
+      Mesh::distortNodesLocally(mesh, maxDistortionRadius, seed);
+  auto perturbedMesh = mesh;
+  for (const auto nodeIndex : nonFixedNodeIndices) {
+    if ((nodes.at(nodeIndex) - nodes.at(centerNodeIndex)).getLength()
+        < perturbationRadius) {
+      perturbedMesh.getMutableNodes().at(nodeIndex) =
+          distortedMesh.getNodes().at(nodeIndex);
+    }
+  }
+  return perturbedMesh;
+}
+
+double getMaxNodeDistance(const Mesh::PolygonalMesh& first,
+                          const Mesh::PolygonalMesh& second) {
+  double maxNodeDistance = 0.0;
+  for (std::size_t nodeIndex = 0; nodeIndex < first.getNumberOfNodes();
+       ++nodeIndex) {
+    maxNodeDistance = std::max(maxNodeDistance,
+                               (first.getNodes().at(nodeIndex)
+                                - second.getNodes().at(nodeIndex))
+                                   .getLength());
+  }
+  return maxNodeDistance;
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::right << std::setw(9) << "fraction" << std::setw(7)
+            << "iter" << std::setw(11) << "time[s]" << std::setw(9)
+            << "speedup" << std::setw(14) << "max deviation"
+            << "\n";
+}
+
+// Compare full and active set smoothing for the given smoothing function,
+// which takes the active set relocation distance fraction to use.
+void compareActiveSetFractions(
+    const std::string& algorithmName,
+    const std::function<Smoothing::SmoothingResult(double)>&
+        smoothingFunction) {
+  std::cout << algorithmName << "\n";
+  printTableHeader();
+  // The first fraction zero run without active set is the reference.
+  const auto [referenceResult, referenceTime] =
+      runRepeatedly([&]() { return smoothingFunction(0.0); });
+  for (const double fraction : {0.0, 0.1, 0.5, 1.0}) {
+    const auto [result, time] =
+        fraction == 0.0
+            ? std::pair(referenceResult, referenceTime)
+            : runRepeatedly([&]() { return smoothingFunction(fraction); });
+    std::cout << "  " << std::right << std::fixed << std::setprecision(1)
+              << std::setw(9) << fraction << std::setw(7) << result.iterations
+              << std::setprecision(4) << std::setw(11) << time
+              << std::setprecision(2) << std::setw(9) << referenceTime / time
+              << std::scientific << std::setw(14)
+              << getMaxNodeDistance(referenceResult.mesh, result.mesh)
+              << std::defaultfloat << "\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares basic Laplace and basic GETMe\n"
+               "simultaneous smoothing with and without active set for\n"
+               "converged meshes, which have been perturbed locally. Fraction\n"
+               "zero denotes smoothing without active set, which is the\n"
+               "reference for speedup and node deviation.\n";
+
+  for (const auto fileName :
+       {"gear_tri_initial.mesh", "gear_quad_initial.mesh",
+        "platonic1_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    std::cout << "\nExample: locally perturbed converged " << fileName << "\n";
+    Common::printInitialMeshInformation(initialMesh);
+
+    Smoothing::BasicLaplaceConfig laplaceConfig(
+        convergedRelocationDistanceThreshold);
+    const auto laplaceMesh = perturbLocally(
+        Smoothing::basicLaplace(initialMesh, laplaceConfig).mesh);
+    laplaceConfig =
+        Smoothing::BasicLaplaceConfig(maxNodeRelocationDistanceThreshold);
+    compareActiveSetFractions("Basic Laplace", [&](const double fraction) {
+      laplaceConfig.activeSetRelocationDistanceFraction = fraction;
+      return Smoothing::basicLaplace(laplaceMesh, laplaceConfig);
+    });
+
+    Smoothing::BasicGetmeSimultaneousConfig getmeConfig(
+        convergedRelocationDistanceThreshold,
+        initialMesh.getMaximalNumberOfPolygonNodes());
+    const auto getmeMesh = perturbLocally(
+        Smoothing::basicGetmeSimultaneous(initialMesh, getmeConfig).mesh);
+    getmeConfig = Smoothing::BasicGetmeSimultaneousConfig(
+        maxNodeRelocationDistanceThreshold,
+        initialMesh.getMaximalNumberOfPolygonNodes());
+    compareActiveSetFractions(
+        "Basic GETMe simultaneous", [&](const double fraction) {
+          getmeConfig.activeSetRelocationDistanceFraction = fraction;
+          return Smoothing::basicGetmeSimultaneous(getmeMesh, getmeConfig);
+        });
+  }
+  std::cout << "\n";
+
+  return 0;
+}
@@ -0,0 +1,663 @@
+/*
+Benchmark comparing the speed and quality trade-offs of smoothing algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+#include "Testdata/mesh_generators.h"
+#include "Utility/exception_handling.h"
+#include "Utility/hardware_counters.h"
+
+#ifdef GETME_HAS_TBB
+#include <tbb/global_control.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+// Node relocation distance threshold of basic Laplace and basic GETMe
+// simultaneous relative to the mean edge length of the mesh.
+constexpr double relativeNodeRelocationDistanceThreshold = 1.0e-3;
+
+// Quality targets of the time-to-target-quality curves are the multiples of
+// this step within (0,1].
+constexpr double qualityTargetStep = 0.05;
+
+// Maximal node distortion radius of the synthetic grid meshes, whose cells
+// have unit edge length. Small enough to preserve the mesh validity.
+constexpr double gridMeshDistortionRadius = 0.2;
+
+// Maximal node distortion radius of the synthetic randomized polygonal mesh,
+// whose edges are shorter than those of the grid meshes.
+constexpr double randomPolygonalMeshDistortionRadius = 0.05;
+
+// Size and spacing of the holes of the synthetic perforated mesh in cells.
+constexpr std::size_t holeSize = 4;
+constexpr std::size_t holeSpacing = 10;
+
+struct Options final {
+  // Number of timed runs per algorithm and mesh.
+  std::size_t repetitions = 3;
+  // Number of threads used by the parallel algorithms. All available hardware
+  // threads are used if not set.
+  std::optional<std::size_t> numberOfThreads;
+  // Number of grid cells per side of the synthetic meshes. No synthetic meshes
+  // are used for zero.
+  std::size_t syntheticGridSize = 100;
+  std::filesystem::path meshDirectoryPath;
+  std::filesystem::path outputFilePath;
+};
+
+// Measurement of one smoothing run.
+struct RunMeasurement final {
+  double wallClockTimeInSeconds;
+  std::size_t iterations;
+  Mesh::MeshQuality meshQuality;
+  std::size_t peakScratchMemoryInBytes;
+  Smoothing::ConvergenceHistory convergenceHistory;
+};
+
+// Smoothing algorithm applied to the given mesh. Records the convergence
+// history of every iteration if requested. GETMe sequential records one
+// history entry per number of polygons iterations instead.
+struct Algorithm final {
+  std::string name;
+  std::function<RunMeasurement(const Mesh::PolygonalMesh&, bool)> run;
+};
+
+struct AlgorithmMeasurement final {
+  std::string algorithmName;
+  std::vector<double> wallClockTimesInSeconds;
+  // Measurement of the last timed run.
+  RunMeasurement lastRun;
+  // Hardware counter values of the calling thread during the last timed run.
+  // Events of parallel loop worker threads are not included.
+  Utility::HardwareCounterValues lastRunHardwareCounterValues;
+  // Convergence history of an additional run recording the history. Its
+  // elapsed times include the overhead of the quality evaluations.
+  Smoothing::ConvergenceHistory convergenceHistory;
+};
+
+struct MeshMeasurement final {
+  std::string meshName;
+  std::size_t numberOfNodes;
+  std::size_t numberOfPolygons;
+  std::size_t meshMemoryInBytes;
+  Mesh::MeshQuality initialMeshQuality;
+  std::vector<AlgorithmMeasurement> algorithmMeasurements;
+};
+
+std::optional<std::size_t> parseCount(const std::string_view value) {
+  std::size_t count = 0;
+  const auto [end, errorCode] =
+      std::from_chars(value.data(), value.data() + value.size(), count);
+  if (errorCode != std::errc() || end != value.data() + value.size()) {
+    return std::nullopt;
+  }
+  return count;
+}
+
+// Parse arguments of the form --name=value. Returns no options if an argument
+// is unknown or invalid.
+std::optional<Options> parseArguments(const int argc,
+                                      char* argv[],
+                                      const std::filesystem::path& dataPath) {
+  Options options;
+  options.meshDirectoryPath = dataPath;
+  options.outputFilePath = dataPath / "algorithm_comparison.json";
+  for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex) {
+    const std::string_view argument(argv[argumentIndex]);
+    const auto separatorIndex = argument.find('=');
+    if (!argument.starts_with("--") || separatorIndex == argument.npos) {
+      return std::nullopt;
+    }
+    const auto name = argument.substr(2, separatorIndex - 2);
+    const auto value = argument.substr(separatorIndex + 1);
+    const auto count = parseCount(value);
+    if (name == "repetitions" && count && *count > 0) {
+      options.repetitions = *count;
+    } else if (name == "threads" && count && *count > 0) {
+      options.numberOfThreads = *count;
+    } else if (name == "grid-size" && count) {
+      options.syntheticGridSize = *count;
+    } else if (name == "mesh-directory" && !value.empty()) {
+      options.meshDirectoryPath = value;
+    } else if (name == "output" && !value.empty()) {
+      options.outputFilePath = value;
+    } else {
+      return std::nullopt;
+    }
+  }
+  return options;
+}
+
+void printUsage(const char* programName) {
+  std::cerr << "Usage: " << programName
+            << " [--repetitions=N] [--threads=N] [--grid-size=N]"
+               " [--mesh-directory=PATH] [--output=PATH]\n";
+}
+
+double getMeanEdgeLength(const Mesh::PolygonalMesh& mesh) {
+  const auto& nodes = mesh.getNodes();
+  double edgeLengthSum = 0.0;
+  std::size_t numberOfEdges = 0;
+  for (const auto& polygon : mesh.getPolygons()) {
+    for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
+         ++nodeNumber) {
+      edgeLengthSum += (nodes.at(polygon.getSuccessorNodeIndex(nodeNumber))
+                        - nodes.at(polygon.getNodeIndex(nodeNumber)))
+                           .getLength();
+      ++numberOfEdges;
+    }
+  }
+  return edgeLengthSum / static_cast<double>(numberOfEdges);
+}
+
+// Get distorted synthetic meshes based on a grid of gridSize x gridSize cells.
+std::vector<std::pair<std::string, Mesh::PolygonalMesh>> getSyntheticMeshes(
+    const std::size_t gridSize) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = gridSize;
+  config.numberOfCellsY = gridSize;
+  config.maxDistortionRadius = gridMeshDistortionRadius;
+  const auto suffix =
+      "_" + std::to_string(gridSize) + "x" + std::to_string(gridSize);
+  std::vector<std::pair<std::string, Mesh::PolygonalMesh>> meshes;
+  meshes.emplace_back(
+      "synthetic_tri_grid" + suffix,
+      Testdata::generateGridMesh(config, Testdata::GridElementType::Triangle));
+  meshes.emplace_back("synthetic_quad_grid" + suffix,
+                      Testdata::generateGridMesh(
+                          config, Testdata::GridElementType::Quadrilateral));
+  meshes.emplace_back("synthetic_perforated_quad_grid" + suffix,
+                      Testdata::generatePerforatedGridMesh(
+                          config, Testdata::GridElementType::Quadrilateral,
+                          holeSize, holeSpacing));
+  config.maxDistortionRadius = randomPolygonalMeshDistortionRadius;
+  meshes.emplace_back("synthetic_random_polygonal" + suffix,
+                      Testdata::generateRandomPolygonalMesh(config));
+  return meshes;
+}
+
+RunMeasurement getRunMeasurement(const Smoothing::SmoothingResult& result) {
+  return {result.smoothingWallClockTimeInSeconds, result.iterations,
+          result.meshQuality, result.peakScratchMemoryInBytes,
+          result.convergenceHistory};
+}
+
+RunMeasurement getRunMeasurement(const Smoothing::GetmeResult& result) {
+  return {result.smoothingWallClockTimeInSeconds,
+          result.getmeSimultaneousIterations + result.getmeSequentialIterations,
+          result.meshQuality, result.peakScratchMemoryInBytes,
+          result.convergenceHistory};
+}
+
+// Get all algorithms using their default configuration. Relocation distance
+// thresholds of the basic algorithms are derived from the given mesh.
+std::vector<Algorithm> getAlgorithms(const Mesh::PolygonalMesh& mesh) {
+  const double maxNodeRelocationDistanceThreshold =
+      relativeNodeRelocationDistanceThreshold * getMeanEdgeLength(mesh);
+  const auto maxNumberOfPolygonNodes = mesh.getMaximalNumberOfPolygonNodes();
+  const std::size_t sequentialHistoryInterval = mesh.getNumberOfPolygons();
+  const auto getInterval = [](const bool recordHistory,
+                              const std::size_t interval) -> std::size_t {
+    return recordHistory ? interval : 0;
+  };
+
+  std::vector<Algorithm> algorithms;
+  algorithms.push_back(
+      {"Basic Laplace",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::BasicLaplaceConfig config(
+             maxNodeRelocationDistanceThreshold);
+         config.convergenceHistoryInterval = getInterval(recordHistory, 1);
+         return getRunMeasurement(
+             Smoothing::basicLaplace(initialMesh, config));
+       }});
+  algorithms.push_back(
+      {"Smart Laplace",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::SmartLaplaceConfig config;
+         config.convergenceHistoryInterval = getInterval(recordHistory, 1);
+         return getRunMeasurement(
+             Smoothing::smartLaplace(initialMesh, config));
+       }});
+  algorithms.push_back(
+      {"Basic GETMe simultaneous",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::BasicGetmeSimultaneousConfig config(
+             maxNodeRelocationDistanceThreshold, maxNumberOfPolygonNodes);
+         config.convergenceHistoryInterval = getInterval(recordHistory, 1);
+         return getRunMeasurement(
+             Smoothing::basicGetmeSimultaneous(initialMesh, config));
+       }});
+  algorithms.push_back(
+      {"GETMe simultaneous",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::GetmeSimultaneousConfig config(maxNumberOfPolygonNodes);
+         config.convergenceHistoryInterval = getInterval(recordHistory, 1);
+         return getRunMeasurement(
+             Smoothing::getmeSimultaneous(initialMesh, config));
+       }});
+  algorithms.push_back(
+      {"GETMe sequential",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::GetmeSequentialConfig config(maxNumberOfPolygonNodes);
+         config.convergenceHistoryInterval =
+             getInterval(recordHistory, sequentialHistoryInterval);
+         return getRunMeasurement(
+             Smoothing::getmeSequential(initialMesh, config));
+       }});
+  algorithms.push_back(
+      {"GETMe",
+       [=](const Mesh::PolygonalMesh& initialMesh, const bool recordHistory) {
+         Smoothing::GetmeConfig config(maxNumberOfPolygonNodes);
+         config.getmeSimultaneousConfig.convergenceHistoryInterval =
+             getInterval(recordHistory, 1);
+         config.getmeSequentialConfig.convergenceHistoryInterval =
+             getInterval(recordHistory, sequentialHistoryInterval);
+         return getRunMeasurement(Smoothing::getme(initialMesh, config));
+       }});
+  return algorithms;
+}
+
+AlgorithmMeasurement measureAlgorithm(const Algorithm& algorithm,
+                                      const Mesh::PolygonalMesh& mesh,
+                                      const std::size_t repetitions) {
+  const auto& hardwareCounters = Utility::getThreadHardwareCounters();
+  std::vector<double> wallClockTimesInSeconds;
+  std::optional<RunMeasurement> lastRun;
+  Utility::HardwareCounterValues lastRunHardwareCounterValues;
+  for (std::size_t run = 0; run < repetitions; ++run) {
+    const auto initialValues = hardwareCounters.read();
+    lastRun = algorithm.run(mesh, false);
+    lastRunHardwareCounterValues = hardwareCounters.read() - initialValues;
+    wallClockTimesInSeconds.push_back(lastRun->wallClockTimeInSeconds);
+  }
+  return {algorithm.name, std::move(wallClockTimesInSeconds),
+          std::move(*lastRun), lastRunHardwareCounterValues,
+          algorithm.run(mesh, true).convergenceHistory};
+}
+
+MeshMeasurement measureMesh(const std::string& meshName,
+                            const Mesh::PolygonalMesh& mesh,
+                            const std::size_t repetitions) {
+  MeshMeasurement meshMeasurement{meshName,
+                                  mesh.getNumberOfNodes(),
+                                  mesh.getNumberOfPolygons(),
+                                  mesh.getMemoryUsage().getTotal().bytes,
+                                  Mesh::MeshQuality(mesh),
+                                  {}};
+  for (const auto& algorithm : getAlgorithms(mesh)) {
+    meshMeasurement.algorithmMeasurements.push_back(
+        measureAlgorithm(algorithm, mesh, repetitions));
+  }
+  return meshMeasurement;
+}
+
+double getMinimalTime(const AlgorithmMeasurement& measurement) {
+  return *std::min_element(measurement.wallClockTimesInSeconds.begin(),
+                           measurement.wallClockTimesInSeconds.end());
+}
+
+double getMeanTime(const AlgorithmMeasurement& measurement) {
+  const auto& times = measurement.wallClockTimesInSeconds;
+  return std::accumulate(times.begin(), times.end(), 0.0)
+         / static_cast<double>(times.size());
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::left << std::setw(26) << "algorithm" << std::right
+            << std::setw(10) << "time[s]" << std::setw(10) << "iter"
+            << std::setw(9) << "qmin" << std::setw(9) << "qmin*"
+            << std::setw(9) << "qmean" << std::setw(14) << "scratch[MiB]"
+            << "\n";
+}
+
+void printTableRow(const AlgorithmMeasurement& measurement) {
+  const auto& quality = measurement.lastRun.meshQuality;
+  std::cout << "  " << std::left << std::setw(26) << measurement.algorithmName
+            << std::right << std::fixed << std::setprecision(4)
+            << std::setw(10) << getMinimalTime(measurement) << std::setw(10)
+            << measurement.lastRun.iterations << std::setw(9)
+            << quality.getQMin() << std::setw(9)
+            << quality.getQMinStar().value_or(
+                   std::numeric_limits<double>::quiet_NaN())
+            << std::setw(9) << quality.getQMean() << std::setprecision(2)
+            << std::setw(14)
+            << static_cast<double>(
+                   measurement.lastRun.peakScratchMemoryInBytes)
+                   / (1024.0 * 1024.0)
+            << std::defaultfloat << "\n";
+}
+
+// Quality number of a convergence record, which is not set for q_min* of
+// meshes consisting of fixed polygons only.
+using QualityGetter =
+    std::function<std::optional<double>(const Smoothing::ConvergenceRecord&)>;
+
+// Get the time-to-target-quality curve of the given quality number, i.e., the
+// elapsed wall clock time at which the quality number reached the target for
+// increasing targets. The initial mesh reaches targets at time zero. The curve
+// ends at the first target not reached.
+std::vector<std::pair<double, double>> getTimeToTargetCurve(
+    const std::optional<double>& initialQuality,
+    const Smoothing::ConvergenceHistory& convergenceHistory,
+    const QualityGetter& getQuality) {
+  std::vector<std::pair<double, double>> curve;
+  const auto numberOfTargets =
+      static_cast<std::size_t>(std::round(1.0 / qualityTargetStep));
+  for (std::size_t targetNumber = 1; targetNumber <= numberOfTargets;
+       ++targetNumber) {
+    const double target = static_cast<double>(targetNumber) * qualityTargetStep;
+    std::optional<double> timeInSeconds;
+    if (initialQuality && *initialQuality >= target) {
+      timeInSeconds = 0.0;
+    } else {
+      for (const auto& record : convergenceHistory) {
+        if (const auto quality = getQuality(record);
+            quality && *quality >= target) {
+          timeInSeconds = record.elapsedWallClockTimeInSeconds;
+          break;
+        }
+      }
+    }
+    if (!timeInSeconds) {
+      break;
+    }
+    curve.emplace_back(target, *timeInSeconds);
+  }
+  return curve;
+}
+
+void writeJsonNumber(const std::optional<double>& value,
+                     std::ostream& outputStream) {
+  if (value && std::isfinite(*value)) {
+    outputStream << *value;
+  } else {
+    outputStream << "null";
+  }
+}
+
+// Write the given string as JSON string. Only quotes and backslashes are
+// escaped, which suffices for file and algorithm names.
+void writeJsonString(const std::string& value, std::ostream& outputStream) {
+  outputStream << "\"";
+  for (const char character : value) {
+    if (character == '"' || character == '\\') {
+      outputStream << "\\";
+    }
+    outputStream << character;
+  }
+  outputStream << "\"";
+}
+
+void writeQuality(const double qMin,
+                  const std::optional<double>& qMinStar,
+                  const double qMean,
+                  std::ostream& outputStream) {
+  outputStream << "\"qMin\":";
+  writeJsonNumber(qMin, outputStream);
+  outputStream << ",\"qMinStar\":";
+  writeJsonNumber(qMinStar, outputStream);
+  outputStream << ",\"qMean\":";
+  writeJsonNumber(qMean, outputStream);
+}
+
+// Write the given hardware counter values as JSON object. Unavailable counters
+// are written as null.
+void writeHardwareCounterValues(const Utility::HardwareCounterValues& values,
+                                std::ostream& outputStream) {
+  outputStream << "{";
+  for (std::size_t counterIndex = 0;
+       counterIndex < Utility::numberOfHardwareCounters; ++counterIndex) {
+    const auto counter = static_cast<Utility::HardwareCounter>(counterIndex);
+    outputStream << (counterIndex > 0 ? "," : "");
+    writeJsonString(std::string(Utility::getHardwareCounterName(counter)),
+                    outputStream);
+    outputStream << ":";
+    if (const auto& value = values.get(counter); value.has_value()) {
+      outputStream << *value;
+    } else {
+      outputStream << "null";
+    }
+  }
+  outputStream << "}";
+}
+
+void writeTimeToTargetCurves(const Mesh::MeshQuality& initialMeshQuality,
+                             const Smoothing::ConvergenceHistory& history,
+                             std::ostream& outputStream) {
+  const std::vector<std::tuple<std::string, std::optional<double>,
+                               QualityGetter>>
+      qualityNumbers{
+          {"qMin", initialMeshQuality.getQMin(),
+           [](const Smoothing::ConvergenceRecord& record)
+               -> std::optional<double> { return record.qMin; }},
+          {"qMinStar", initialMeshQuality.getQMinStar(),
+           [](const Smoothing::ConvergenceRecord& record) {
+             return record.qMinStar;
+           }},
+          {"qMean", initialMeshQuality.getQMean(),
+           [](const Smoothing::ConvergenceRecord& record)
+               -> std::optional<double> { return record.qMean; }}};
+  outputStream << "\"timeToTargetQuality\":{";
+  for (std::size_t numberIndex = 0; numberIndex < qualityNumbers.size();
+       ++numberIndex) {
+    const auto& [name, initialQuality, getQuality] =
+        qualityNumbers.at(numberIndex);
+    outputStream << (numberIndex > 0 ? "," : "") << "\"" << name << "\":[";
+    const auto curve = getTimeToTargetCurve(initialQuality, history,
+                                            getQuality);
+    for (std::size_t pointIndex = 0; pointIndex < curve.size(); ++pointIndex) {
+      // Targets are written rounded to avoid representation artifacts.
+      const auto precision = outputStream.precision(6);
+      outputStream << (pointIndex > 0 ? "," : "") << "{\"target\":"
+                   << curve.at(pointIndex).first;
+      outputStream.precision(precision);
+      outputStream << ",\"timeInSeconds\":" << curve.at(pointIndex).second
+                   << "}";
+    }
+    outputStream << "]";
+  }
+  outputStream << "}";
+}
+
+void writeAlgorithmMeasurement(const AlgorithmMeasurement& measurement,
+                               const Mesh::MeshQuality& initialMeshQuality,
+                               std::ostream& outputStream) {
+  const auto& lastRun = measurement.lastRun;
+  outputStream << "{\"algorithm\":";
+  writeJsonString(measurement.algorithmName, outputStream);
+  outputStream << ",\"wallClockTimesInSeconds\":[";
+  for (std::size_t run = 0; run < measurement.wallClockTimesInSeconds.size();
+       ++run) {
+    outputStream << (run > 0 ? "," : "")
+                 << measurement.wallClockTimesInSeconds.at(run);
+  }
+  outputStream << "],\"minimalWallClockTimeInSeconds\":"
+               << getMinimalTime(measurement)
+               << ",\"meanWallClockTimeInSeconds\":" << getMeanTime(measurement)
+               << ",\"iterations\":" << lastRun.iterations << ",";
+  writeQuality(lastRun.meshQuality.getQMin(), lastRun.meshQuality.getQMinStar(),
+               lastRun.meshQuality.getQMean(), outputStream);
+  outputStream << ",\"peakScratchMemoryInBytes\":"
+               << lastRun.peakScratchMemoryInBytes
+               << ",\"lastRunHardwareCounters\":";
+  writeHardwareCounterValues(measurement.lastRunHardwareCounterValues,
+                             outputStream);
+  outputStream << ",\"qualityCurve\":[";
+  for (std::size_t recordIndex = 0;
+       recordIndex < measurement.convergenceHistory.size(); ++recordIndex) {
+    const auto& record = measurement.convergenceHistory.at(recordIndex);
+    outputStream << (recordIndex > 0 ? "," : "")
+                 << "{\"iteration\":" << record.iteration
+                 << ",\"elapsedWallClockTimeInSeconds\":"
+                 << record.elapsedWallClockTimeInSeconds << ",";
+    writeQuality(record.qMin, record.qMinStar, record.qMean, outputStream);
+    outputStream << "}";
+  }
+  outputStream << "],";
+  writeTimeToTargetCurves(initialMeshQuality, measurement.convergenceHistory,
+                          outputStream);
+  outputStream << "}";
+}
+
+void writeJsonReport(const std::vector<MeshMeasurement>& meshMeasurements,
+                     const std::size_t repetitions,
+                     const std::size_t numberOfThreads,
+                     const std::filesystem::path& filePath) {
+  std::ofstream outputStream(filePath);
+  Utility::throwExceptionIfFalse(outputStream.is_open(),
+                                 "Cannot open benchmark report file.");
+  outputStream << std::setprecision(std::numeric_limits<double>::max_digits10)
+               << "{\"repetitions\":" << repetitions
+               << ",\"threads\":" << numberOfThreads << ",\"meshes\":[";
+  for (std::size_t meshIndex = 0; meshIndex < meshMeasurements.size();
+       ++meshIndex) {
+    const auto& meshMeasurement = meshMeasurements.at(meshIndex);
+    const auto& initialQuality = meshMeasurement.initialMeshQuality;
+    outputStream << (meshIndex > 0 ? "," : "") << "\n{\"mesh\":";
+    writeJsonString(meshMeasurement.meshName, outputStream);
+    outputStream << ",\"numberOfNodes\":" << meshMeasurement.numberOfNodes
+                 << ",\"numberOfPolygons\":"
+                 << meshMeasurement.numberOfPolygons
+                 << ",\"meshMemoryInBytes\":"
+                 << meshMeasurement.meshMemoryInBytes
+                 << ",\"initialQuality\":{";
+    writeQuality(initialQuality.getQMin(), initialQuality.getQMinStar(),
+                 initialQuality.getQMean(), outputStream);
+    outputStream << "},\"results\":[";
+    const auto& algorithmMeasurements = meshMeasurement.algorithmMeasurements;
+    for (std::size_t algorithmIndex = 0;
+         algorithmIndex < algorithmMeasurements.size(); ++algorithmIndex) {
+      outputStream << (algorithmIndex > 0 ? "," : "") << "\n";
+      writeAlgorithmMeasurement(algorithmMeasurements.at(algorithmIndex),
+                                initialQuality, outputStream);
+    }
+    outputStream << "]}";
+  }
+  outputStream << "]}\n";
+}
+
+// Get the initial meshes of the given directory ordered by file name.
+std::vector<std::filesystem::path> getMeshFilePaths(
+    const std::filesystem::path& meshDirectoryPath) {
+  Utility::throwExceptionIfFalse(
+      std::filesystem::is_directory(meshDirectoryPath),
+      "Mesh directory does not exist.");
+  std::vector<std::filesystem::path> meshFilePaths;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(meshDirectoryPath)) {
+    if (entry.is_regular_file()
+        && entry.path().filename().string().ends_with("_initial.mesh")) {
+      meshFilePaths.push_back(entry.path());
+    }
+  }
+  std::sort(meshFilePaths.begin(), meshFilePaths.end());
+  return meshFilePaths;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+  const auto options = parseArguments(argc, argv, dataPath);
+  if (!options) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+#ifdef GETME_HAS_TBB
+  std::optional<tbb::global_control> threadLimit;
+  if (options->numberOfThreads) {
+    threadLimit.emplace(tbb::global_control::max_allowed_parallelism,
+                        *options->numberOfThreads);
+  }
+  const std::size_t numberOfThreads = tbb::global_control::active_value(
+      tbb::global_control::max_allowed_parallelism);
+#else
+  if (options->numberOfThreads) {
+    std::cerr << "Limiting the number of threads requires TBB.\n";
+    return 1;
+  }
+  const std::size_t numberOfThreads = std::thread::hardware_concurrency();
+#endif
+
+  std::cout << "\nThis program compares all smoothing algorithms using their\n"
+               "default configuration for the initial meshes and distorted\n"
+               "synthetic meshes. Times are the minimal smoothing times\n"
+               "of "
+            << options->repetitions << " runs using " << numberOfThreads
+            << " threads. Hardware counter\n"
+               "values of the last run are given if available. They only\n"
+               "include the events of the calling thread, not those of\n"
+               "parallel loop worker threads.\n";
+
+  std::vector<std::pair<std::string, Mesh::PolygonalMesh>> meshes;
+  for (const auto& meshFilePath :
+       getMeshFilePaths(options->meshDirectoryPath)) {
+    meshes.emplace_back(meshFilePath.filename().string(),
+                        Mesh::readMeshFile(meshFilePath));
+  }
+  if (options->syntheticGridSize > 0) {
+    for (auto& syntheticMesh : getSyntheticMeshes(options->syntheticGridSize)) {
+      meshes.push_back(std::move(syntheticMesh));
+    }
+  }
+
+  std::vector<MeshMeasurement> meshMeasurements;
+  for (const auto& [meshName, mesh] : meshes) {
+    std::cout << "\nExample: " << meshName << "\n";
+    Common::printInitialMeshInformation(mesh);
+    meshMeasurements.push_back(
+        measureMesh(meshName, mesh, options->repetitions));
+    printTableHeader();
+    for (const auto& measurement :
+         meshMeasurements.back().algorithmMeasurements) {
+      printTableRow(measurement);
+      Common::printHardwareCounterValues(
+          measurement.lastRunHardwareCounterValues, "    ");
+    }
+  }
+
+  writeJsonReport(meshMeasurements, options->repetitions, numberOfThreads,
+                  options->outputFilePath);
+  std::cout << "\nReport written to " << options->outputFilePath.string()
+            << "\n\n";
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+/*
+Regression benchmark of resetting nodes of invalid elements.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+#include "Utility/phase_timer.h"
+#include "Utility/stop_watch.h"
+#include "common_algorithms.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+// Number of runs per configuration. The minimal time is reported.
+constexpr std::size_t numberOfRuns = 5;
+
+// Reference implementation rescanning all polygons in each reset round, as
+// used before the worklist based implementation. Returns the number of reset
+// rounds.
+std::size_t resetNodesByFullRescan(
+    std::vector<Mathematics::Vector2D>& newNodePositions,
+    const std::vector<Mathematics::Vector2D>& oldNodePositions,
+    std::vector<double>& polygonMeanRatioValues,
+    const Mesh::PolygonalMesh& mesh) {
+  const auto& polygons = mesh.getPolygons();
+  Mesh::computeMeanRatioQualityNumberOfPolygons(polygons, newNodePositions,
+                                                polygonMeanRatioValues);
+  std::size_t numberOfRounds = 0;
+  while (true) {
+    std::unordered_set<std::size_t> indicesOfNodesToReset;
+    for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+         ++polygonIndex) {
+      if (polygonMeanRatioValues.at(polygonIndex) <= 0.0) {
+        for (const auto nodeIndex :
+             polygons.at(polygonIndex).getNodeIndices()) {
+          indicesOfNodesToReset.insert(nodeIndex);
+        }
+      }
+    }
+    if (indicesOfNodesToReset.empty()) {
+      return numberOfRounds;
+    }
+    ++numberOfRounds;
+    std::unordered_set<std::size_t> indicesOfAffectedPolygons;
+    for (const auto nodeIndex : indicesOfNodesToReset) {
+      newNodePositions.at(nodeIndex) = oldNodePositions.at(nodeIndex);
+      const auto& attachedPolygonIndices =
+          mesh.getAttachedPolygonIndices(nodeIndex);
+      indicesOfAffectedPolygons.insert(attachedPolygonIndices.begin(),
+                                       attachedPolygonIndices.end());
+    }
+    for (const auto polygonIndex : indicesOfAffectedPolygons) {
+      polygonMeanRatioValues.at(polygonIndex) = Mathematics::getMeanRatio(
+          polygons.at(polygonIndex), newNodePositions);
+    }
+  }
+}
+
+// Run the given reset function repeatedly on copies of the distorted nodes
+// and return the minimal time. The reset nodes of the last run are returned in
+// resultNodes.
+double getMinimalResetTime(
+    const std::vector<Mathematics::Vector2D>& distortedNodes,
+    std::vector<Mathematics::Vector2D>& resultNodes,
+    const std::function<void(std::vector<Mathematics::Vector2D>&)>&
+        resetFunction) {
+  double minimalTime = std::numeric_limits<double>::infinity();
+  for (std::size_t run = 0; run < numberOfRuns; ++run) {
+    resultNodes = distortedNodes;
+    Utility::StopWatch stopWatch;
+    resetFunction(resultNodes);
+    stopWatch.stop();
+    minimalTime = std::min(minimalTime, stopWatch.getElapsedTimeInSeconds());
+  }
+  return minimalTime;
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::right << std::setw(8) << "radius" << std::setw(10)
+            << "invalid" << std::setw(8) << "rounds" << std::setw(13)
+            << "rescan[s]" << std::setw(13) << "worklist[s]" << std::setw(9)
+            << "speedup" << std::setw(7) << "equal"
+            << "\n";
+}
+
+// Distort the given mesh, reset nodes of invalid elements using both
+// implementations and print the timings.
+void compareResets(const Mesh::PolygonalMesh& mesh,
+                   const double maxDistortionRadius) {
+  const std::uint64_t seed = 1;
+  const auto distortedNodes =
+      Mesh::distortNodesLocally(mesh, maxDistortionRadius, seed).getNodes();
+  std::vector<double> polygonMeanRatioValues(mesh.getNumberOfPolygons());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(
+      mesh.getPolygons(), distortedNodes, polygonMeanRatioValues);
+  const auto numberOfInvalidPolygons =
+      std::count_if(polygonMeanRatioValues.begin(),
+                    polygonMeanRatioValues.end(),
+                    [](const double value) { return value <= 0.0; });
+
+  std::size_t numberOfRounds = 0;
+  std::vector<Mathematics::Vector2D> rescanNodes;
+  const double rescanTime = getMinimalResetTime(
+      distortedNodes, rescanNodes,
+      [&](std::vector<Mathematics::Vector2D>& nodes) {
+        numberOfRounds = resetNodesByFullRescan(nodes, mesh.getNodes(),
+                                                polygonMeanRatioValues, mesh);
+      });
+
+  Smoothing::SmoothingWorkspace workspace(mesh.getNumberOfNodes(),
+                                          mesh.getNumberOfPolygons());
+  std::vector<Mathematics::Vector2D> worklistNodes;
+  Utility::PhaseTimes phaseTimes;
+  const double worklistTime = getMinimalResetTime(
+      distortedNodes, worklistNodes,
+      [&](std::vector<Mathematics::Vector2D>& nodes) {
+        Smoothing::iterativelyResetNodesResultingInInvalidElements(
+            nodes, mesh.getNodes(), polygonMeanRatioValues, mesh,
+            workspace.getInvalidElementResetBuffers(), phaseTimes);
+      });
+
+  std::cout << "  " << std::right << std::fixed << std::setprecision(3)
+            << std::setw(8) << maxDistortionRadius << std::setw(10)
+            << numberOfInvalidPolygons << std::setw(8) << numberOfRounds
+            << std::setprecision(6) << std::setw(13) << rescanTime
+            << std::setw(13) << worklistTime << std::setprecision(2)
+            << std::setw(9) << rescanTime / worklistTime << std::setw(7)
+            << (rescanNodes == worklistNodes ? "yes" : "no")
+            << std::defaultfloat << "\n";
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares the time required to iteratively\n"
+               "reset nodes of invalid elements of locally distorted meshes\n"
+               "using a full rescan of all polygons in each reset round and\n"
+               "the worklist based implementation, which only reassesses\n"
+               "polygons affected by the previous round.\n";
+
+  for (const auto fileName :
+       {"gear_tri_initial.mesh", "gear_quad_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    std::cout << "\nExample: " << fileName << "\n";
+    Common::printInitialMeshInformation(initialMesh);
+    printTableHeader();
+    for (const double maxDistortionRadius : {0.01, 0.05, 0.1, 0.2}) {
+      compareResets(initialMesh, maxDistortionRadius);
+    }
+  }
+  std::cout << "\n";
+
+  return 0;
+}
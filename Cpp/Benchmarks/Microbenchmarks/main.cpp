@@ -0,0 +1,63 @@
+/*
+Microbenchmarks of the mathematics, mesh and smoothing kernels.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "microbenchmarks.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cmath>
+#include <numbers>
+#include <numeric>
+
+namespace Microbenchmarks {
+Mathematics::Polygon getPolygon(const std::size_t numberOfNodes) {
+  std::vector<std::size_t> nodeIndices(numberOfNodes);
+  std::iota(nodeIndices.begin(), nodeIndices.end(), 0);
+  return Mathematics::Polygon(nodeIndices);
+}
+
+std::vector<Mathematics::Vector2D> getIrregularPolygonNodes(
+    const std::size_t numberOfNodes) {
+  std::vector<Mathematics::Vector2D> nodes;
+  for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes; ++nodeNumber) {
+    const double angle = 2.0 * std::numbers::pi
+                         * static_cast<double>(nodeNumber)
+                         / static_cast<double>(numberOfNodes);
+    const double radius = nodeNumber % 2 == 0 ? 1.0 : 1.2;
+    nodes.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+  }
+  return nodes;
+}
+}  // namespace Microbenchmarks
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+  Microbenchmarks::registerMeshBenchmarks(dataPath);
+  Microbenchmarks::registerSmoothingBenchmarks(dataPath);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,69 @@
+/*
+Microbenchmarks of polygon quality and transformation kernels.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mathematics/generalized_polygon_transformation.h"
+#include "Mathematics/polygon_algorithms.h"
+#include "microbenchmarks.h"
+
+#include "benchmark/benchmark.h"
+
+namespace {
+// Polygon sizes of the shipped meshes and a polygon exceeding the inline node
+// index capacity of Mathematics::Polygon.
+void applyPolygonSizes(benchmark::internal::Benchmark* benchmark) {
+  for (const int numberOfNodes : {3, 4, 5, 6, 8, 12, 16}) {
+    benchmark->Arg(numberOfNodes);
+  }
+}
+
+template <typename Scalar>
+void BM_getMeanRatio(benchmark::State& state) {
+  const auto numberOfNodes = static_cast<std::size_t>(state.range(0));
+  const auto polygon = Microbenchmarks::getPolygon(numberOfNodes);
+  std::vector<Mathematics::BasicVector2D<Scalar>> nodes;
+  Mathematics::convertVectors(
+      Microbenchmarks::getIrregularPolygonNodes(numberOfNodes), nodes);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Mathematics::getMeanRatio(polygon, nodes));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_getMeanRatio<double>)->Apply(applyPolygonSizes);
+BENCHMARK(BM_getMeanRatio<float>)->Apply(applyPolygonSizes);
+
+template <typename Scalar>
+void BM_getNodesOfTransformedPolygon(benchmark::State& state) {
+  const auto numberOfNodes = static_cast<std::size_t>(state.range(0));
+  const auto polygon = Microbenchmarks::getPolygon(numberOfNodes);
+  std::vector<Mathematics::BasicVector2D<Scalar>> nodes;
+  Mathematics::convertVectors(
+      Microbenchmarks::getIrregularPolygonNodes(numberOfNodes), nodes);
+  const Mathematics::GeneralizedPolygonTransformation transformation(
+      numberOfNodes);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        transformation.getNodesOfTransformedPolygon(polygon, nodes));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_getNodesOfTransformedPolygon<double>)->Apply(applyPolygonSizes);
+BENCHMARK(BM_getNodesOfTransformedPolygon<float>)->Apply(applyPolygonSizes);
+}  // namespace
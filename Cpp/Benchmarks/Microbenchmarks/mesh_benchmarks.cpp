@@ -0,0 +1,78 @@
+/*
+Microbenchmarks of mesh construction and mesh file input and output.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mesh/polygonal_mesh.h"
+#include "Mesh/polygonal_mesh_algorithms.h"
+#include "microbenchmarks.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+namespace Microbenchmarks {
+void registerMeshBenchmarks(const std::filesystem::path& dataPath) {
+  for (const std::string fileName : meshFileNames) {
+    const auto meshFilePath = dataPath / fileName;
+
+    benchmark::RegisterBenchmark(
+        ("BM_PolygonalMesh_constructor/" + fileName).c_str(),
+        [meshFilePath](benchmark::State& state) {
+          const auto mesh = Mesh::readMeshFile(meshFilePath);
+          for (auto _ : state) {
+            benchmark::DoNotOptimize(
+                Mesh::PolygonalMesh(mesh.getNodes(), mesh.getPolygons(),
+                                    mesh.getFixedNodeIndices()));
+          }
+          state.SetItemsProcessed(
+              state.iterations()
+              * static_cast<std::int64_t>(mesh.getNumberOfPolygons()));
+        });
+
+    benchmark::RegisterBenchmark(
+        ("BM_readMeshFile/" + fileName).c_str(),
+        [meshFilePath](benchmark::State& state) {
+          for (auto _ : state) {
+            benchmark::DoNotOptimize(Mesh::readMeshFile(meshFilePath));
+          }
+          state.SetBytesProcessed(
+              state.iterations()
+              * static_cast<std::int64_t>(
+                  std::filesystem::file_size(meshFilePath)));
+        });
+
+    benchmark::RegisterBenchmark(
+        ("BM_writeMeshFile/" + fileName).c_str(),
+        [meshFilePath, fileName](benchmark::State& state) {
+          const auto mesh = Mesh::readMeshFile(meshFilePath);
+          const auto outfilePath = std::filesystem::temp_directory_path()
+                                   / ("getme_microbenchmark_" + fileName);
+          for (auto _ : state) {
+            Mesh::writeMeshFile(mesh, outfilePath);
+          }
+          state.SetBytesProcessed(
+              state.iterations()
+              * static_cast<std::int64_t>(
+                  std::filesystem::file_size(outfilePath)));
+          std::filesystem::remove(outfilePath);
+        });
+  }
+}
+}  // namespace Microbenchmarks
@@ -0,0 +1,50 @@
+/*
+Microbenchmarks of the mathematics, mesh and smoothing kernels.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Benchmarks depending on mesh files are registered at runtime, since mesh
+// files are located in the directory of the executable.
+#pragma once
+
+#include "Mathematics/polygon.h"
+#include "Mathematics/vector2d.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Microbenchmarks {
+// Mesh files copied to the directory of the executable.
+inline constexpr const char* meshFileNames[] = {
+    "gear_quad_initial.mesh", "gear_tri_initial.mesh",
+    "platonic1_initial.mesh", "platonic2_initial.mesh",
+    "platonic3_initial.mesh"};
+
+// Polygon with the given number of nodes and node indices 0, ..., n-1.
+Mathematics::Polygon getPolygon(const std::size_t numberOfNodes);
+
+// Nodes of a valid but irregular polygon with the given number of nodes,
+// whose odd nodes are moved outwards.
+std::vector<Mathematics::Vector2D> getIrregularPolygonNodes(
+    const std::size_t numberOfNodes);
+
+void registerMeshBenchmarks(const std::filesystem::path& dataPath);
+
+void registerSmoothingBenchmarks(const std::filesystem::path& dataPath);
+}  // namespace Microbenchmarks
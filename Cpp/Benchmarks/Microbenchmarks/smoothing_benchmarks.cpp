@@ -0,0 +1,127 @@
+/*
+Microbenchmarks of smoothing kernels.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mathematics/generalized_polygon_transformation.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Mesh/polygonal_mesh_algorithms.h"
+#include "Utility/counter_based_random.h"
+#include "common_algorithms.h"
+#include "microbenchmarks.h"
+#include "polygon_quality_min_heap.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <string>
+
+namespace {
+void applyPolygonSizes(benchmark::internal::Benchmark* benchmark) {
+  for (const int numberOfNodes : {3, 4, 5, 6, 8, 12, 16}) {
+    benchmark->Arg(numberOfNodes);
+  }
+}
+
+template <typename Scalar>
+void BM_applyEdgeLengthScaling(benchmark::State& state) {
+  const auto numberOfNodes = static_cast<std::size_t>(state.range(0));
+  const auto polygon = Microbenchmarks::getPolygon(numberOfNodes);
+  std::vector<Mathematics::BasicVector2D<Scalar>> nodes;
+  Mathematics::convertVectors(
+      Microbenchmarks::getIrregularPolygonNodes(numberOfNodes), nodes);
+  auto transformedNodes =
+      Mathematics::GeneralizedPolygonTransformation(numberOfNodes)
+          .getNodesOfTransformedPolygon(polygon, nodes);
+  // Scaling is idempotent. Hence, repeated in place scaling is representative.
+  for (auto _ : state) {
+    Smoothing::applyEdgeLengthScaling(polygon, nodes, transformedNodes);
+    benchmark::DoNotOptimize(transformedNodes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_applyEdgeLengthScaling<double>)->Apply(applyPolygonSizes);
+BENCHMARK(BM_applyEdgeLengthScaling<float>)->Apply(applyPolygonSizes);
+
+// Repeatedly update the quality of polygons selected by the given function
+// with pseudo random qualities. This covers sifting entries up and down.
+template <typename PolygonSelection>
+void benchmarkMinHeapUpdates(benchmark::State& state,
+                             const Mesh::PolygonalMesh& mesh,
+                             const PolygonSelection& selectPolygonIndex) {
+  Smoothing::PolygonQualityMinHeap minHeap(mesh);
+  const std::uint64_t seed = 1;
+  std::uint64_t counter = 0;
+  for (auto _ : state) {
+    const auto polygonIndex = selectPolygonIndex(minHeap, counter);
+    minHeap.updateMeanRatioNumberIfNotFixedPolygon(
+        polygonIndex, Utility::getUniformRandomNumber(seed, counter));
+    ++counter;
+  }
+  benchmark::DoNotOptimize(minHeap.getLowestQualityPolygonIndex());
+  state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+namespace Microbenchmarks {
+void registerSmoothingBenchmarks(const std::filesystem::path& dataPath) {
+  for (const std::string fileName : meshFileNames) {
+    const auto mesh = Mesh::readMeshFile(dataPath / fileName);
+
+    benchmark::RegisterBenchmark(
+        ("BM_PolygonQualityMinHeap_constructor/" + fileName).c_str(),
+        [mesh](benchmark::State& state) {
+          for (auto _ : state) {
+            benchmark::DoNotOptimize(Smoothing::PolygonQualityMinHeap(mesh));
+          }
+          state.SetItemsProcessed(
+              state.iterations()
+              * static_cast<std::int64_t>(mesh.getNumberOfPolygons()));
+        });
+
+    // Access pattern of GETMe sequential, which always updates the lowest
+    // quality polygon.
+    benchmark::RegisterBenchmark(
+        ("BM_PolygonQualityMinHeap_updateLowest/" + fileName).c_str(),
+        [mesh](benchmark::State& state) {
+          benchmarkMinHeapUpdates(
+              state, mesh,
+              [](const Smoothing::PolygonQualityMinHeap& minHeap,
+                 std::uint64_t) {
+                return minHeap.getLowestQualityPolygonIndex();
+              });
+        });
+
+    // Updates of arbitrary polygons, e.g. neighbors of transformed polygons.
+    benchmark::RegisterBenchmark(
+        ("BM_PolygonQualityMinHeap_updateRandom/" + fileName).c_str(),
+        [mesh](benchmark::State& state) {
+          const std::uint64_t seed = 2;
+          benchmarkMinHeapUpdates(
+              state, mesh,
+              [&](const Smoothing::PolygonQualityMinHeap&,
+                  const std::uint64_t counter) {
+                return Utility::getRandomBits(seed, counter)
+                       % mesh.getNumberOfPolygons();
+              });
+        });
+  }
+}
+}  // namespace Microbenchmarks
@@ -0,0 +1,189 @@
+/*
+Benchmark of momentum accelerated simultaneous smoothing.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace {
+// Smoothing function taking the momentum factor and the maximal number of
+// iterations.
+using SmoothingFunction =
+    std::function<Smoothing::SmoothingResult(double, std::size_t)>;
+
+// Iterations and smoothing time of the first run reaching a target quality.
+struct TargetQualityRun final {
+  std::size_t iterations = 0;
+  double timeInSeconds = 0.0;
+};
+
+bool isTargetQMeanReached(const Smoothing::SmoothingResult& result,
+                          const double targetQMean) {
+  return result.meshQuality.getQMean() >= targetQMean;
+}
+
+// Find the minimal iteration limit for which the result reaches the given
+// target qmean value by exponential and binary search. Since qmean is not
+// necessarily monotonic in the number of iterations, this is an estimate.
+// Returns nothing if the target is not reached before regular termination.
+std::optional<TargetQualityRun> findTargetQualityRun(
+    const SmoothingFunction& smoothingFunction,
+    const double momentumFactor,
+    const double targetQMean) {
+  std::size_t upperLimit = 1;
+  while (true) {
+    const auto result = smoothingFunction(momentumFactor, upperLimit);
+    if (isTargetQMeanReached(result, targetQMean)) {
+      break;
+    }
+    if (result.iterations < upperLimit
+        || upperLimit >= Smoothing::DefaultConfiguration::maxIterations) {
+      return std::nullopt;
+    }
+    upperLimit *= 2;
+  }
+  std::size_t lowerLimit = upperLimit / 2;
+  while (lowerLimit + 1 < upperLimit) {
+    const std::size_t limit = (lowerLimit + upperLimit) / 2;
+    if (isTargetQMeanReached(smoothingFunction(momentumFactor, limit),
+                             targetQMean)) {
+      upperLimit = limit;
+    } else {
+      lowerLimit = limit;
+    }
+  }
+  const auto result = smoothingFunction(momentumFactor, upperLimit);
+  return TargetQualityRun{result.iterations,
+                          result.smoothingWallClockTimeInSeconds};
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::right << std::setw(5) << "beta" << std::setw(7)
+            << "iter" << std::setw(10) << "time[s]" << std::setw(9) << "qmin"
+            << std::setw(9) << "qmean" << std::setw(13) << "target iter"
+            << std::setw(16) << "target time[s]"
+            << "\n";
+}
+
+// Smooth with all momentum factors until regular termination. In addition,
+// the iterations and time required to reach the final qmean value of
+// smoothing without momentum are given.
+void compareMomentumFactors(const std::string& algorithmName,
+                            const SmoothingFunction& smoothingFunction) {
+  std::cout << algorithmName << "\n";
+  printTableHeader();
+  const double targetQMean =
+      smoothingFunction(0.0, Smoothing::DefaultConfiguration::maxIterations)
+          .meshQuality.getQMean();
+  for (const double momentumFactor : {0.0, 0.3, 0.5, 0.7}) {
+    const auto result = smoothingFunction(
+        momentumFactor, Smoothing::DefaultConfiguration::maxIterations);
+    const auto targetQualityRun =
+        findTargetQualityRun(smoothingFunction, momentumFactor, targetQMean);
+    std::cout << "  " << std::right << std::fixed << std::setprecision(1)
+              << std::setw(5) << momentumFactor << std::setw(7)
+              << result.iterations << std::setprecision(4) << std::setw(10)
+              << result.smoothingWallClockTimeInSeconds << std::setw(9)
+              << result.meshQuality.getQMin() << std::setw(9)
+              << result.meshQuality.getQMean();
+    if (targetQualityRun) {
+      std::cout << std::setw(13) << targetQualityRun->iterations
+                << std::setw(16) << targetQualityRun->timeInSeconds;
+    } else {
+      std::cout << std::setw(13) << "-" << std::setw(16) << "-";
+    }
+    std::cout << std::defaultfloat << "\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares simultaneous smoothing with and\n"
+               "without momentum acceleration. Target iterations and time\n"
+               "denote the first iteration reaching the qmean value of\n"
+               "smoothing without momentum (beta=0).\n";
+
+  // Basic smoothing of the distorted Platonic meshes.
+  for (const auto fileName :
+       {"platonic1_initial.mesh", "platonic2_initial.mesh",
+        "platonic3_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    const double maxDistortionRadius = 5.0;
+    const std::uint64_t seed = 1;
+    const auto distortedMesh =
+        Mesh::distortNodesLocally(initialMesh, maxDistortionRadius, seed);
+    std::cout << "\nExample: distorted " << fileName << "\n";
+    Common::printInitialMeshInformation(distortedMesh);
+
+    const double maxNodeRelocationDistanceThreshold = 0.01;
+    Smoothing::BasicLaplaceConfig laplaceConfig(
+        maxNodeRelocationDistanceThreshold);
+    compareMomentumFactors(
+        "Basic Laplace", [&](const double momentumFactor,
+                             const std::size_t maxIterations) {
+          laplaceConfig.momentumFactor = momentumFactor;
+          laplaceConfig.maxIterations = maxIterations;
+          return Smoothing::basicLaplace(distortedMesh, laplaceConfig);
+        });
+
+    Smoothing::BasicGetmeSimultaneousConfig getmeConfig(
+        maxNodeRelocationDistanceThreshold,
+        distortedMesh.getMaximalNumberOfPolygonNodes(),
+        Smoothing::DefaultConfiguration::PolygonTransformationSet::Generic);
+    compareMomentumFactors(
+        "Basic GETMe simultaneous", [&](const double momentumFactor,
+                                        const std::size_t maxIterations) {
+          getmeConfig.momentumFactor = momentumFactor;
+          getmeConfig.maxIterations = maxIterations;
+          return Smoothing::basicGetmeSimultaneous(distortedMesh, getmeConfig);
+        });
+  }
+
+  // GETMe simultaneous smoothing of the valid gear meshes.
+  for (const auto fileName :
+       {"gear_tri_initial.mesh", "gear_quad_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    std::cout << "\nExample: " << fileName << "\n";
+    Common::printInitialMeshInformation(initialMesh);
+
+    Smoothing::GetmeSimultaneousConfig config(
+        initialMesh.getMaximalNumberOfPolygonNodes());
+    compareMomentumFactors(
+        "GETMe simultaneous", [&](const double momentumFactor,
+                                  const std::size_t maxIterations) {
+          config.momentumFactor = momentumFactor;
+          config.maxIterations = maxIterations;
+          return Smoothing::getmeSimultaneous(initialMesh, config);
+        });
+  }
+  std::cout << "\n";
+
+  return 0;
+}
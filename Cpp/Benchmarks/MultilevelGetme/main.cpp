@@ -0,0 +1,196 @@
+/*
+Benchmark of multilevel GETMe for meshes with large scale distortions.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+#include "Testdata/mesh_generators.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Number of runs per configuration. The minimal smoothing time is reported.
+constexpr std::size_t numberOfRuns = 3;
+
+// Run the given smoothing function repeatedly and return the result of the
+// last run together with the minimal smoothing time of all runs.
+template <typename Result>
+std::pair<Result, double> runRepeatedly(
+    const std::function<Result()>& smoothingFunction) {
+  double minimalTime = std::numeric_limits<double>::infinity();
+  for (std::size_t run = 1; run < numberOfRuns; ++run) {
+    minimalTime = std::min(minimalTime,
+                           smoothingFunction().smoothingWallClockTimeInSeconds);
+  }
+  auto result = smoothingFunction();
+  minimalTime = std::min(minimalTime, result.smoothingWallClockTimeInSeconds);
+  return {std::move(result), minimalTime};
+}
+
+// Shear the non fixed nodes horizontally by a sine bump over the mesh bounding
+// box. The maximal displacement is the given fraction of the mesh width.
+Mesh::PolygonalMesh distortLargeScale(const Mesh::PolygonalMesh& mesh,
+                                      const double amplitude) {
+  const auto boundingBox = Mathematics::getBoundingBox(mesh.getNodes());
+  auto distortedMesh = mesh;
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    auto& node = distortedMesh.getMutableNodes().at(nodeIndex);
+    const double u =
+        (node.getX() - boundingBox.getXMin()) / boundingBox.getXDimension();
+    const double v =
+        (node.getY() - boundingBox.getYMin()) / boundingBox.getYDimension();
+    node += Mathematics::Vector2D(amplitude * boundingBox.getXDimension()
+                                      * std::sin(std::numbers::pi * u)
+                                      * std::sin(std::numbers::pi * v),
+                                  0.0);
+  }
+  return distortedMesh;
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::left << std::setw(18) << "algorithm" << std::right
+            << std::setw(10) << "time[s]" << std::setw(10) << "coarse[s]"
+            << std::setw(14) << "iterations" << std::setw(9) << "qmin"
+            << std::setw(9) << "qmean"
+            << "\n";
+}
+
+void printTableRow(const Smoothing::SmoothingResultBase& result,
+                   const double time,
+                   const double coarseLevelsTime,
+                   const std::size_t getmeSimultaneousIterations,
+                   const std::size_t getmeSequentialIterations) {
+  std::cout << "  " << std::left << std::setw(18) << result.algorithmName
+            << std::right << std::fixed << std::setprecision(4)
+            << std::setw(10) << time << std::setw(10) << coarseLevelsTime
+            << std::setw(14)
+            << std::to_string(getmeSimultaneousIterations) + "/"
+                   + std::to_string(getmeSequentialIterations)
+            << std::setw(9) << result.meshQuality.getQMin() << std::setw(9)
+            << result.meshQuality.getQMean() << std::defaultfloat << "\n";
+}
+
+// Number of cells per side of the synthetic meshes, which results in about one
+// million elements.
+constexpr std::size_t syntheticMeshSize = 1000;
+
+// Compare GETMe and multilevel GETMe for the given mesh.
+void compareGetmeVariants(const Mesh::PolygonalMesh& mesh) {
+  const Smoothing::MultilevelGetmeConfig config(
+      mesh.getMaximalNumberOfPolygonNodes());
+  printTableHeader();
+  const auto [getmeResult, getmeTime] =
+      runRepeatedly<Smoothing::GetmeResult>(
+          [&]() { return Smoothing::getme(mesh, config.getmeConfig); });
+  printTableRow(getmeResult, getmeTime, 0.0,
+                getmeResult.getmeSimultaneousIterations,
+                getmeResult.getmeSequentialIterations);
+  const auto [multilevelResult, multilevelTime] =
+      runRepeatedly<Smoothing::MultilevelGetmeResult>(
+          [&]() { return Smoothing::multilevelGetme(mesh, config); });
+  printTableRow(multilevelResult, multilevelTime,
+                multilevelResult.coarseLevelsWallClockTimeInSeconds,
+                multilevelResult.getmeSimultaneousIterations,
+                multilevelResult.getmeSequentialIterations);
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares GETMe and multilevel GETMe smoothing\n"
+               "for meshes smoothed by GETMe and for synthetic meshes with\n"
+               "one million elements, whose non fixed nodes have been\n"
+               "sheared by a sine bump over the mesh. The amplitude is\n"
+               "given as fraction of the mesh width. Iterations are given as\n"
+               "GETMe simultaneous/GETMe sequential iterations.\n";
+
+  for (const auto fileName :
+       {"gear_quad_initial.mesh", "platonic1_initial.mesh",
+        "platonic2_initial.mesh", "platonic3_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    const auto smoothedMesh =
+        Smoothing::getme(initialMesh,
+                         Smoothing::GetmeConfig(
+                             initialMesh.getMaximalNumberOfPolygonNodes()))
+            .mesh;
+    for (const double amplitude : {0.005, 0.02, 0.05}) {
+      const auto distortedMesh = distortLargeScale(smoothedMesh, amplitude);
+      std::cout << "\nExample: GETMe smoothed " << fileName
+                << " sheared by amplitude " << amplitude << "\n";
+      Common::printInitialMeshInformation(distortedMesh);
+      if (!Mesh::MeshQuality(distortedMesh).isValidMesh()) {
+        std::cout << "  Skipped since the sheared mesh is invalid.\n";
+        continue;
+      }
+      compareGetmeVariants(distortedMesh);
+    }
+  }
+
+  // Synthetic meshes with local distortions, which are sheared like the file
+  // based meshes. Random polygonal meshes are already distorted by their
+  // generator. Meshes are generated one at a time to limit memory usage.
+  const std::vector<
+      std::pair<std::string, std::function<Mesh::PolygonalMesh()>>>
+      syntheticMeshGenerators = {
+          {"quad grid",
+           []() {
+             Testdata::MeshGeneratorConfig generatorConfig;
+             generatorConfig.numberOfCellsX = syntheticMeshSize;
+             generatorConfig.numberOfCellsY = syntheticMeshSize;
+             generatorConfig.maxDistortionRadius = 0.25;
+             return Testdata::generateGridMesh(
+                 generatorConfig, Testdata::GridElementType::Quadrilateral);
+           }},
+          {"random polygonal", []() {
+             Testdata::MeshGeneratorConfig generatorConfig;
+             generatorConfig.numberOfCellsX = syntheticMeshSize;
+             generatorConfig.numberOfCellsY = syntheticMeshSize;
+             return Testdata::generateRandomPolygonalMesh(generatorConfig);
+           }}};
+  for (const auto& [meshName, generateMesh] : syntheticMeshGenerators) {
+    const auto mesh = generateMesh();
+    for (const double amplitude : {0.005, 0.02}) {
+      const auto distortedMesh = distortLargeScale(mesh, amplitude);
+      std::cout << "\nExample: Synthetic " << meshName << " mesh with "
+                << mesh.getNumberOfPolygons()
+                << " elements sheared by amplitude " << amplitude << "\n";
+      Common::printInitialMeshInformation(distortedMesh);
+      if (!Mesh::MeshQuality(distortedMesh).isValidMesh()) {
+        std::cout << "  Skipped since the sheared mesh is invalid.\n";
+        continue;
+      }
+      compareGetmeVariants(distortedMesh);
+    }
+  }
+  std::cout << "\n";
+
+  return 0;
+}
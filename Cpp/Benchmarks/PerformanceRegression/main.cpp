@@ -0,0 +1,414 @@
+/*
+Performance regression test comparing representative workloads to a baseline.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/smoothing_headers.h"
+#include "Testdata/mesh_generators.h"
+#include "Utility/event_counters.h"
+#include "Utility/exception_handling.h"
+#include "Utility/phase_timer.h"
+#include "Utility/stop_watch.h"
+#include "Utility/tracing.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+// Return code signaling CTest a skipped test.
+constexpr int skipReturnCode = 77;
+
+// Relative tolerances of metrics not yet contained in a baseline file.
+constexpr double defaultTimeTolerance = 0.5;
+constexpr double defaultQualityTolerance = 1.0e-3;
+
+// Number of cells per side of the synthetic grid mesh, which results in one
+// million elements.
+constexpr std::size_t syntheticGridSize = 1000;
+
+struct Options final {
+  // Number of timed runs per workload. The minimal time is compared.
+  std::size_t repetitions = 5;
+  // Baseline of the quality metrics, which is independent of the machine.
+  std::filesystem::path baselineFilePath;
+  // Baseline of the times, which depend on the machine. Hence, it is kept
+  // local to the build and recorded by the first run if it does not exist.
+  std::filesystem::path timeBaselineFilePath;
+  // Write the measured quality metrics or times to the respective baseline
+  // file instead of comparing.
+  bool updateBaseline = false;
+  bool updateTimeBaseline = false;
+  std::filesystem::path meshDirectoryPath;
+};
+
+// Measured metric of a workload. Times are better if lower, quality numbers
+// are better if higher.
+struct Measurement final {
+  std::string workloadName;
+  std::string metricName;
+  double value;
+  bool isLowerBetter;
+};
+
+struct BaselineEntry final {
+  double value;
+  // Maximal relative deviation in the worse direction not considered as
+  // regression.
+  double relativeTolerance;
+};
+
+// Baseline entries by workload and metric name.
+using Baseline =
+    std::map<std::pair<std::string, std::string>, BaselineEntry>;
+
+// Parse arguments of the form --name=value or --name. Returns no options if
+// an argument is unknown or invalid.
+std::optional<Options> parseArguments(const int argc,
+                                      char* argv[],
+                                      const std::filesystem::path& dataPath) {
+  Options options;
+  options.baselineFilePath = dataPath / "performance_baseline.txt";
+  options.timeBaselineFilePath = dataPath / "performance_time_baseline.txt";
+  options.meshDirectoryPath = dataPath;
+  for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex) {
+    const std::string_view argument(argv[argumentIndex]);
+    const auto separatorIndex = argument.find('=');
+    const auto value = separatorIndex == argument.npos
+                           ? std::string_view()
+                           : argument.substr(separatorIndex + 1);
+    if (argument == "--update-baseline") {
+      options.updateBaseline = true;
+    } else if (argument == "--update-time-baseline") {
+      options.updateTimeBaseline = true;
+    } else if (argument.starts_with("--repetitions=")) {
+      const auto [end, errorCode] = std::from_chars(
+          value.data(), value.data() + value.size(), options.repetitions);
+      if (errorCode != std::errc() || end != value.data() + value.size()
+          || options.repetitions == 0) {
+        return std::nullopt;
+      }
+    } else if (argument.starts_with("--baseline=") && !value.empty()) {
+      options.baselineFilePath = value;
+    } else if (argument.starts_with("--time-baseline=") && !value.empty()) {
+      options.timeBaselineFilePath = value;
+    } else if (argument.starts_with("--mesh-directory=") && !value.empty()) {
+      options.meshDirectoryPath = value;
+    } else {
+      return std::nullopt;
+    }
+  }
+  return options;
+}
+
+// Read the baseline file consisting of lines
+//   workload metric value relativeTolerance
+// Empty lines and lines starting with # are ignored. Returns an empty baseline
+// if the file does not exist.
+Baseline readBaseline(const std::filesystem::path& filePath) {
+  Baseline baseline;
+  std::ifstream inputStream(filePath);
+  if (!inputStream.is_open()) {
+    return baseline;
+  }
+  std::string line;
+  while (std::getline(inputStream, line)) {
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+    std::istringstream lineStream(line);
+    std::string workloadName;
+    std::string metricName;
+    BaselineEntry entry{};
+    lineStream >> workloadName >> metricName >> entry.value
+        >> entry.relativeTolerance;
+    Utility::throwExceptionIfTrue(lineStream.fail()
+                                      || entry.relativeTolerance < 0.0,
+                                  "Invalid performance baseline line.");
+    baseline[{workloadName, metricName}] = entry;
+  }
+  return baseline;
+}
+
+// Write the measured times or quality metrics as new baseline. Tolerances of
+// existing entries are kept. Entries of workloads without measurements, e.g.
+// skipped workloads, are kept as well.
+void writeBaseline(const std::vector<Measurement>& measurements,
+                   const Baseline& baseline,
+                   const bool writeTimes,
+                   const std::filesystem::path& filePath) {
+  std::ofstream outputStream(filePath);
+  Utility::throwExceptionIfFalse(outputStream.is_open(),
+                                 "Cannot open performance baseline file.");
+  outputStream << "# " << (writeTimes ? "Time" : "Quality")
+               << " baseline of benchmark_performanceregression.\n"
+                  "# Line format: workload metric value relativeTolerance\n"
+               << (writeTimes ? "# Local to the machine. Update it by "
+                                "--update-time-baseline.\n"
+                              : "# Update it by --update-baseline.\n")
+               << std::setprecision(6);
+  for (const auto& measurement : measurements) {
+    if (measurement.isLowerBetter != writeTimes) {
+      continue;
+    }
+    const auto entry =
+        baseline.find({measurement.workloadName, measurement.metricName});
+    const double relativeTolerance =
+        entry != baseline.end() ? entry->second.relativeTolerance
+        : measurement.isLowerBetter ? defaultTimeTolerance
+                                    : defaultQualityTolerance;
+    outputStream << measurement.workloadName << " " << measurement.metricName
+                 << " " << measurement.value << " " << relativeTolerance
+                 << "\n";
+  }
+  for (const auto& [key, entry] : baseline) {
+    const auto isWorkloadMeasured = [&key](const Measurement& measurement) {
+      return measurement.workloadName == key.first;
+    };
+    if (std::ranges::none_of(measurements, isWorkloadMeasured)) {
+      outputStream << key.first << " " << key.second << " " << entry.value
+                   << " " << entry.relativeTolerance << "\n";
+    }
+  }
+}
+
+// Run the given function repeatedly and return the result of the last run
+// together with the minimal wall clock time of all runs.
+template <typename Result>
+std::pair<Result, double> runRepeatedly(
+    const std::size_t repetitions,
+    const std::function<Result()>& function) {
+  double minimalTime = std::numeric_limits<double>::infinity();
+  for (std::size_t run = 1; run < repetitions; ++run) {
+    Utility::StopWatch stopWatch;
+    function();
+    minimalTime = std::min(minimalTime, stopWatch.getElapsedTimeInSeconds());
+  }
+  Utility::StopWatch stopWatch;
+  auto result = function();
+  minimalTime = std::min(minimalTime, stopWatch.getElapsedTimeInSeconds());
+  return {std::move(result), minimalTime};
+}
+
+// GETMe smoothing of the Europe mesh, which is not part of all distributions.
+// Skipped without measurements if the mesh file is not available.
+std::vector<Measurement> measureEuropeGetme(const Options& options) {
+  const std::string workloadName = "europe_getme";
+  const auto meshFilePath =
+      options.meshDirectoryPath / "europe_mixed_initial.mesh";
+  if (!std::filesystem::exists(meshFilePath)) {
+    std::cout << "  " << workloadName << ": SKIPPED since "
+              << meshFilePath.string()
+              << " does not exist. Pass --mesh-directory=PATH to use a mesh "
+                 "directory containing it.\n";
+    return {};
+  }
+  const auto mesh = Mesh::readMeshFile(meshFilePath);
+  const Smoothing::GetmeConfig config(mesh.getMaximalNumberOfPolygonNodes());
+  const auto [result, time] = runRepeatedly<Smoothing::GetmeResult>(
+      options.repetitions, [&]() { return Smoothing::getme(mesh, config); });
+  return {{workloadName, "wallClockTimeInSeconds", time, true},
+          {workloadName, "qMin", result.meshQuality.getQMin(), false},
+          {workloadName, "qMean", result.meshQuality.getQMean(), false}};
+}
+
+// GETMe sequential smoothing of the gear quad mesh smoothed by GETMe
+// simultaneous, i.e., the sequential phase of GETMe.
+std::vector<Measurement> measureGearGetmeSequential(const Options& options) {
+  const std::string workloadName = "gear_quad_getme_sequential";
+  const auto initialMesh =
+      Mesh::readMeshFile(options.meshDirectoryPath / "gear_quad_initial.mesh");
+  const auto maxNumberOfPolygonNodes =
+      initialMesh.getMaximalNumberOfPolygonNodes();
+  const auto mesh =
+      Smoothing::getmeSimultaneous(
+          initialMesh,
+          Smoothing::GetmeSimultaneousConfig(maxNumberOfPolygonNodes))
+          .mesh;
+  const Smoothing::GetmeSequentialConfig config(maxNumberOfPolygonNodes);
+  const auto [result, time] = runRepeatedly<Smoothing::SmoothingResult>(
+      options.repetitions,
+      [&]() { return Smoothing::getmeSequential(mesh, config); });
+  return {{workloadName, "wallClockTimeInSeconds", time, true},
+          {workloadName, "qMinStar",
+           result.meshQuality.getQMinStar().value_or(0.0), false},
+          {workloadName, "qMean", result.meshQuality.getQMean(), false}};
+}
+
+// Quality evaluation of a distorted synthetic grid mesh with one million
+// elements.
+std::vector<Measurement> measureSyntheticMeshQuality(const Options& options) {
+  const std::string workloadName = "synthetic_quad_grid_quality";
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = syntheticGridSize;
+  config.numberOfCellsY = syntheticGridSize;
+  config.maxDistortionRadius = 0.25;
+  const auto mesh = Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral);
+  const auto [meshQuality, time] = runRepeatedly<Mesh::MeshQuality>(
+      options.repetitions, [&]() { return Mesh::MeshQuality(mesh); });
+  return {{workloadName, "wallClockTimeInSeconds", time, true},
+          {workloadName, "qMean", meshQuality.getQMean(), false}};
+}
+
+// Compare the measurements to the baseline and print a report. Returns the
+// number of regressions, i.e., metrics worse than their baseline value by
+// more than the relative tolerance.
+std::size_t compareToBaseline(const std::vector<Measurement>& measurements,
+                              const Baseline& baseline) {
+  std::cout << "\n  " << std::left << std::setw(30) << "workload"
+            << std::setw(24) << "metric" << std::right << std::setw(12)
+            << "baseline" << std::setw(12) << "measured" << std::setw(10)
+            << "change" << std::setw(11) << "tolerance"
+            << "  status\n";
+  std::size_t numberOfRegressions = 0;
+  for (const auto& measurement : measurements) {
+    std::cout << "  " << std::left << std::setw(30) << measurement.workloadName
+              << std::setw(24) << measurement.metricName << std::right
+              << std::setprecision(6);
+    const auto entry =
+        baseline.find({measurement.workloadName, measurement.metricName});
+    if (entry == baseline.end()) {
+      std::cout << std::setw(12) << "-" << std::setw(12) << measurement.value
+                << std::setw(10) << "-" << std::setw(11) << "-"
+                << "  no baseline\n";
+      continue;
+    }
+    const auto& [baselineValue, relativeTolerance] = entry->second;
+    const double relativeChange =
+        (measurement.value - baselineValue) / baselineValue;
+    // Positive for deteriorations.
+    const double relativeDeterioration =
+        measurement.isLowerBetter ? relativeChange : -relativeChange;
+    const bool isRegression = relativeDeterioration > relativeTolerance;
+    const bool isImprovement = -relativeDeterioration > relativeTolerance;
+    numberOfRegressions += isRegression ? 1 : 0;
+    std::cout << std::setw(12) << baselineValue << std::setw(12)
+              << measurement.value << std::fixed << std::setprecision(1)
+              << std::setw(9) << 100.0 * relativeChange << "%" << std::setw(10)
+              << 100.0 * relativeTolerance << "%" << std::defaultfloat << "  "
+              << (isRegression    ? "REGRESSION"
+                  : isImprovement ? "improved"
+                                  : "ok")
+              << "\n";
+  }
+  return numberOfRegressions;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+  const auto options = parseArguments(argc, argv, dataPath);
+  if (!options) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--repetitions=N] [--baseline=PATH] [--time-baseline=PATH]"
+                 " [--mesh-directory=PATH] [--update-baseline]"
+                 " [--update-time-baseline]\n";
+    return 1;
+  }
+
+  std::cout << "\nThis program measures representative workloads and\n"
+               "compares them to a baseline. It fails if a metric is worse\n"
+               "than its baseline value by more than the relative tolerance.\n";
+
+#ifndef NDEBUG
+  const bool isDebugBuild = true;
+#else
+  const bool isDebugBuild = false;
+#endif
+  if (isDebugBuild || Utility::arePhaseTimersEnabled
+      || Utility::areEventCountersEnabled || Utility::isTracingEnabled) {
+    std::cout << "Skipped since debug and instrumented builds are not "
+                 "representative.\n\n";
+    return skipReturnCode;
+  }
+
+  std::cout << "\nMeasuring workloads using " << options->repetitions
+            << " runs each.\n";
+  std::vector<Measurement> measurements;
+  // Workloads without measurements have been skipped.
+  std::size_t numberOfSkippedWorkloads = 0;
+  for (const auto& measureWorkload :
+       {measureEuropeGetme, measureGearGetmeSequential,
+        measureSyntheticMeshQuality}) {
+    const auto workloadMeasurements = measureWorkload(*options);
+    numberOfSkippedWorkloads += workloadMeasurements.empty() ? 1 : 0;
+    measurements.insert(measurements.end(), workloadMeasurements.begin(),
+                        workloadMeasurements.end());
+  }
+
+  auto baseline = readBaseline(options->baselineFilePath);
+  auto timeBaseline = readBaseline(options->timeBaselineFilePath);
+  if (options->updateBaseline || options->updateTimeBaseline) {
+    for (const auto& [update, writeTimes, fileBaseline, filePath] :
+         {std::tuple(options->updateBaseline, false, baseline,
+                     options->baselineFilePath),
+          std::tuple(options->updateTimeBaseline, true, timeBaseline,
+                     options->timeBaselineFilePath)}) {
+      if (update) {
+        writeBaseline(measurements, fileBaseline, writeTimes, filePath);
+        std::cout << "\nBaseline written to " << filePath.string() << "\n";
+      }
+    }
+    std::cout << "\n";
+    return 0;
+  }
+  if (timeBaseline.empty()) {
+    writeBaseline(measurements, timeBaseline, true,
+                  options->timeBaselineFilePath);
+    std::cout << "\nNo time baseline found. The measured times have been "
+                 "recorded in\n"
+              << options->timeBaselineFilePath.string()
+              << " and are compared by subsequent runs.\n";
+  }
+
+  baseline.merge(timeBaseline);
+  const auto numberOfRegressions = compareToBaseline(measurements, baseline);
+  if (numberOfRegressions > 0) {
+    std::cout << "\nPerformance regression detected for "
+              << numberOfRegressions
+              << " metric(s). If intended, update the baselines by "
+                 "--update-baseline or --update-time-baseline.\n\n";
+    return 1;
+  }
+  std::cout << "\nNo performance regression detected.\n";
+  if (numberOfSkippedWorkloads > 0) {
+    // A partial run must not pass unnoticed as complete run.
+    std::cout << numberOfSkippedWorkloads
+              << " workload(s) skipped, see above. Reported as skipped "
+                 "test.\n\n";
+    return skipReturnCode;
+  }
+  std::cout << "\n";
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+/*
+Benchmark comparing double, single and mixed precision GETMe smoothing.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+#include "Utility/hardware_counters.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+using Precision = Smoothing::DefaultConfiguration::FloatingPointPrecision;
+
+// Number of runs per configuration. The minimal smoothing time is reported.
+constexpr std::size_t numberOfRuns = 3;
+
+std::string getPrecisionName(const Precision precision) {
+  switch (precision) {
+    case Precision::Double:
+      return "double";
+    case Precision::Single:
+      return "single";
+    case Precision::Mixed:
+      return "mixed";
+  }
+  return "unknown";
+}
+
+struct RepeatedRunResult {
+  Smoothing::SmoothingResult result;
+  double minimalTime;
+  Utility::HardwareCounterValues lastRunHardwareCounterValues;
+};
+
+// Run the given smoothing function repeatedly and return the result and the
+// hardware counter values of the calling thread during the last run together
+// with the minimal smoothing time of all runs.
+RepeatedRunResult runRepeatedly(
+    const std::function<Smoothing::SmoothingResult()>& smoothingFunction,
+    const Utility::HardwareCounters& hardwareCounters) {
+  double minimalTime = std::numeric_limits<double>::infinity();
+  for (std::size_t run = 1; run < numberOfRuns; ++run) {
+    minimalTime = std::min(minimalTime,
+                           smoothingFunction().smoothingWallClockTimeInSeconds);
+  }
+  const auto initialValues = hardwareCounters.read();
+  auto result = smoothingFunction();
+  const auto hardwareCounterValues = hardwareCounters.read() - initialValues;
+  minimalTime = std::min(minimalTime, result.smoothingWallClockTimeInSeconds);
+  return {std::move(result), minimalTime, hardwareCounterValues};
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::left << std::setw(8) << "mode" << std::right
+            << std::setw(7) << "iter" << std::setw(11) << "time[s]"
+            << std::setw(9) << "speedup" << std::setw(9) << "qmin"
+            << std::setw(9) << "qmean" << std::setw(12) << "qmean loss"
+            << "\n";
+}
+
+void printTableRow(const Precision precision,
+                   const Smoothing::SmoothingResult& result,
+                   const double time,
+                   const double referenceTime,
+                   const double referenceQMean) {
+  const auto& meshQuality = result.meshQuality;
+  std::cout << "  " << std::left << std::setw(8) << getPrecisionName(precision)
+            << std::right << std::setw(7) << result.iterations << std::fixed
+            << std::setprecision(4) << std::setw(11) << time
+            << std::setprecision(2) << std::setw(9) << referenceTime / time
+            << std::setprecision(4) << std::setw(9) << meshQuality.getQMin()
+            << std::setw(9) << meshQuality.getQMean() << std::scientific
+            << std::setprecision(2) << std::setw(12)
+            << referenceQMean - meshQuality.getQMean() << std::defaultfloat
+            << "\n";
+}
+
+// Compare all precisions for the given smoothing function, which takes the
+// precision to use.
+void comparePrecisions(
+    const std::string& algorithmName,
+    const std::vector<Precision>& precisions,
+    const std::function<Smoothing::SmoothingResult(Precision)>&
+        smoothingFunction,
+    const Utility::HardwareCounters& hardwareCounters) {
+  std::cout << algorithmName << "\n";
+  printTableHeader();
+  double referenceTime = 0.0;
+  double referenceQMean = 0.0;
+  for (const auto precision : precisions) {
+    const auto [result, time, hardwareCounterValues] =
+        runRepeatedly([&]() { return smoothingFunction(precision); },
+                      hardwareCounters);
+    if (precision == Precision::Double) {
+      referenceTime = time;
+      referenceQMean = result.meshQuality.getQMean();
+    }
+    printTableRow(precision, result, time, referenceTime, referenceQMean);
+    Common::printHardwareCounterValues(hardwareCounterValues, "    ");
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares the smoothing time and resulting mesh\n"
+               "quality of GETMe simultaneous smoothing variants using\n"
+               "double, single and mixed floating point precision. Speedup\n"
+               "and quality loss are given with respect to double precision.\n"
+               "Hardware counter values of the last run are given if\n"
+               "available. They only include the events of the calling\n"
+               "thread, not those of parallel loop worker threads.\n";
+
+  const Utility::HardwareCounters hardwareCounters;
+
+  // GETMe simultaneous smoothing of the valid gear meshes.
+  for (const auto fileName :
+       {"gear_tri_initial.mesh", "gear_quad_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    std::cout << "\nExample: " << fileName << "\n";
+    Common::printInitialMeshInformation(initialMesh);
+
+    Smoothing::GetmeSimultaneousConfig config(
+        initialMesh.getMaximalNumberOfPolygonNodes());
+    comparePrecisions(
+        "GETMe simultaneous",
+        {Precision::Double, Precision::Single, Precision::Mixed},
+        [&](const Precision precision) {
+          config.floatingPointPrecision = precision;
+          return Smoothing::getmeSimultaneous(initialMesh, config);
+        },
+        hardwareCounters);
+  }
+
+  // Basic GETMe simultaneous smoothing of the distorted Platonic meshes. Since
+  // this algorithm does not involve element quality, mixed precision equals
+  // single precision.
+  for (const auto fileName :
+       {"platonic1_initial.mesh", "platonic2_initial.mesh",
+        "platonic3_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    const double maxDistortionRadius = 5.0;
+    const std::uint64_t seed = 1;
+    const auto distortedMesh =
+        Mesh::distortNodesLocally(initialMesh, maxDistortionRadius, seed);
+    std::cout << "\nExample: distorted " << fileName << "\n";
+    Common::printInitialMeshInformation(distortedMesh);
+
+    const double maxNodeRelocationDistanceThreshold = 0.01;
+    Smoothing::BasicGetmeSimultaneousConfig config(
+        maxNodeRelocationDistanceThreshold,
+        distortedMesh.getMaximalNumberOfPolygonNodes(),
+        Smoothing::DefaultConfiguration::PolygonTransformationSet::Generic);
+    comparePrecisions("Basic GETMe simultaneous",
+                      {Precision::Double, Precision::Single},
+                      [&](const Precision precision) {
+                        config.floatingPointPrecision = precision;
+                        return Smoothing::basicGetmeSimultaneous(distortedMesh,
+                                                                 config);
+                      },
+                      hardwareCounters);
+  }
+  std::cout << "\n";
+
+  return 0;
+}
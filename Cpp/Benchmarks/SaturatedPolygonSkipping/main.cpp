@@ -0,0 +1,129 @@
+/*
+Benchmark of skipping quality saturated polygons in GETMe simultaneous.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+#include "Common/smoothing_headers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+// Number of runs per configuration. The minimal smoothing time is reported.
+constexpr std::size_t numberOfRuns = 3;
+
+// Share of polygons of the given mesh, whose weight is below the saturation
+// weight threshold.
+double getSaturatedPolygonShare(const Mesh::PolygonalMesh& mesh,
+                                const double weightExponentEta,
+                                const double saturationWeightThreshold) {
+  std::vector<double> polygonMeanRatioValues(mesh.getNumberOfPolygons());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(
+      mesh.getPolygons(), mesh.getNodes(), polygonMeanRatioValues);
+  const auto numberOfSaturatedPolygons = std::count_if(
+      polygonMeanRatioValues.begin(), polygonMeanRatioValues.end(),
+      [&](const double meanRatio) {
+        return std::pow(1.0 - meanRatio, weightExponentEta)
+               < saturationWeightThreshold;
+      });
+  return static_cast<double>(numberOfSaturatedPolygons)
+         / static_cast<double>(mesh.getNumberOfPolygons());
+}
+
+void printTableHeader() {
+  std::cout << "  " << std::right << std::setw(5) << "eta" << std::setw(11)
+            << "threshold" << std::setw(6) << "iter" << std::setw(10)
+            << "time[s]" << std::setw(13) << "time/iter[s]" << std::setw(9)
+            << "speedup" << std::setw(11) << "saturated" << std::setw(9)
+            << "qmin" << std::setw(9) << "qmean"
+            << "\n";
+}
+
+// Smooth the given mesh using the given eta and all saturation weight
+// thresholds. Speedup is given with respect to the time per iteration without
+// skipping saturated polygons.
+void compareSaturationWeightThresholds(const Mesh::PolygonalMesh& mesh,
+                                       const double weightExponentEta) {
+  Smoothing::GetmeSimultaneousConfig config(
+      mesh.getMaximalNumberOfPolygonNodes());
+  config.weightExponentEta = weightExponentEta;
+  double referenceTimePerIteration = 0.0;
+  for (const double saturationWeightThreshold : {0.0, 1.0e-3, 1.0e-2, 5.0e-2}) {
+    config.saturationWeightThreshold = saturationWeightThreshold;
+    double minimalTime = std::numeric_limits<double>::infinity();
+    for (std::size_t run = 1; run < numberOfRuns; ++run) {
+      minimalTime =
+          std::min(minimalTime, Smoothing::getmeSimultaneous(mesh, config)
+                                    .smoothingWallClockTimeInSeconds);
+    }
+    const auto result = Smoothing::getmeSimultaneous(mesh, config);
+    minimalTime = std::min(minimalTime, result.smoothingWallClockTimeInSeconds);
+    const double timePerIteration =
+        minimalTime / static_cast<double>(result.iterations);
+    if (saturationWeightThreshold == 0.0) {
+      referenceTimePerIteration = timePerIteration;
+    }
+    const auto& meshQuality = result.meshQuality;
+    std::cout << "  " << std::right << std::fixed << std::setprecision(1)
+              << std::setw(5) << weightExponentEta << std::scientific
+              << std::setprecision(1) << std::setw(11)
+              << saturationWeightThreshold << std::setw(6) << result.iterations
+              << std::fixed << std::setprecision(4) << std::setw(10)
+              << minimalTime << std::scientific << std::setprecision(2)
+              << std::setw(13) << timePerIteration << std::fixed
+              << std::setw(9) << referenceTimePerIteration / timePerIteration
+              << std::setprecision(3) << std::setw(11)
+              << getSaturatedPolygonShare(result.mesh, weightExponentEta,
+                                          saturationWeightThreshold)
+              << std::setprecision(4) << std::setw(9) << meshQuality.getQMin()
+              << std::setw(9) << meshQuality.getQMean() << std::defaultfloat
+              << "\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+
+  std::cout << "\nThis program compares the time per iteration and resulting\n"
+               "mesh quality of GETMe simultaneous smoothing for different\n"
+               "saturation weight thresholds. Polygons with a weight below\n"
+               "the threshold are not transformed. The share of such\n"
+               "polygons is given for the resulting mesh.\n";
+
+  for (const auto fileName :
+       {"gear_tri_initial.mesh", "gear_quad_initial.mesh"}) {
+    const auto initialMesh = Mesh::readMeshFile(dataPath / fileName);
+    std::cout << "\nExample: " << fileName << "\n";
+    Common::printInitialMeshInformation(initialMesh);
+    printTableHeader();
+    for (const double weightExponentEta : {0.5, 1.0, 2.0}) {
+      compareSaturationWeightThresholds(initialMesh, weightExponentEta);
+    }
+  }
+  std::cout << "\n";
+
+  return 0;
+}
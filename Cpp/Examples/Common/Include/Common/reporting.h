@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <filesystem>
+#include <iosfwd>
 #include <string>
 
 namespace Mesh {
@@ -31,17 +32,59 @@ class PolygonalMesh;
 
 namespace Smoothing {
 class GetmeResult;
+class MultilevelGetmeResult;
 class SmoothingResult;
+class SmoothingResultBase;
 }  // namespace Smoothing
 
+namespace Utility {
+class HardwareCounterValues;
+}  // namespace Utility
+
 namespace Common {
 void printInitialMeshInformation(const Mesh::PolygonalMesh& mesh);
 
+// Print the heap memory of the mesh data structures and their overhead, i.e.
+// the fraction of memory not used for storing values.
+void printMeshMemoryUsage(const Mesh::PolygonalMesh& mesh);
+
+// Print the available hardware counter values and the resulting instructions
+// per cycle in one line. Prints nothing if no value is available.
+void printHardwareCounterValues(const Utility::HardwareCounterValues& values,
+                                const std::string& indentation);
+
 void printSmoothingResult(const Smoothing::SmoothingResult& result);
 
 void printSmoothingResult(const Smoothing::GetmeResult& result);
 
+void printSmoothingResult(const Smoothing::MultilevelGetmeResult& result);
+
+// Write the convergence history of the given result as JSON Lines, i.e., one
+// JSON object per line and record. Unset values are written as null. The
+// format of the given stream is restored afterwards.
+void writeConvergenceHistoryAsJsonLines(
+    const Smoothing::SmoothingResultBase& result,
+    std::ostream& outputStream);
+
+// Write the convergence history of the given result as CSV including a header
+// line. Unset values are written as empty fields. The format of the given
+// stream is restored afterwards.
+void writeConvergenceHistoryAsCsv(const Smoothing::SmoothingResultBase& result,
+                                  std::ostream& outputStream);
+
+// Write the convergence history of the given result to the given file. The
+// format is determined by the file extension, which must be .jsonl or .csv.
+void writeConvergenceHistory(const Smoothing::SmoothingResultBase& result,
+                             const std::filesystem::path& filePath);
+
 void writeResultMesh(const Mesh::PolygonalMesh& mesh,
                      const std::filesystem::path& initialMeshPath,
                      const std::string& meshName);
+
+// Write the convergence history of the given result next to the result mesh
+// of the given name. The file extension .jsonl or .csv determines the format.
+void writeResultConvergenceHistory(const Smoothing::SmoothingResultBase& result,
+                                   const std::filesystem::path& initialMeshPath,
+                                   const std::string& meshName,
+                                   const std::string& extension);
 }  // namespace Common
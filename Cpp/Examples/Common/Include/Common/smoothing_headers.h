@@ -28,6 +28,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/polygonal_mesh_algorithms.h"
 #include "Smoothing/basic_getme_simultaneous_config.h"
 #include "Smoothing/basic_laplace_config.h"
+#include "Smoothing/convergence_history.h"
 #include "Smoothing/default_configuration.h"
 #include "Smoothing/getme_algorithms.h"
 #include "Smoothing/getme_config.h"
@@ -35,5 +36,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Smoothing/getme_sequential_config.h"
 #include "Smoothing/getme_simultaneous_config.h"
 #include "Smoothing/laplace_algorithms.h"
+#include "Smoothing/multilevel_getme_config.h"
+#include "Smoothing/multilevel_getme_result.h"
+#include "Smoothing/quality_targets.h"
 #include "Smoothing/smart_laplace_config.h"
+#include "Smoothing/smoothing_observer.h"
 #include "Smoothing/smoothing_result.h"
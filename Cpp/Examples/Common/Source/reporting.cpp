@@ -27,14 +27,23 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
 #include "Smoothing/getme_result.h"
+#include "Smoothing/multilevel_getme_result.h"
 #include "Smoothing/smoothing_result.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
+#include "Utility/hardware_counters.h"
+#include "Utility/memory_usage.h"
 
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <iomanip>
+#include <ios>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <optional>
+#include <string_view>
 
 namespace {
 struct ZeroDefaultedCount {
@@ -113,12 +122,102 @@ void printMeshQuality(const Mesh::MeshQuality& meshQuality,
   }
 }
 
+double getMebibytes(const std::size_t bytes) {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+void printMemoryUsage(const std::string_view name,
+                      const Utility::MemoryUsage& memoryUsage) {
+  const double overheadFraction =
+      memoryUsage.bytes > 0
+          ? static_cast<double>(memoryUsage.getOverheadBytes())
+                / static_cast<double>(memoryUsage.bytes)
+          : 0.0;
+  std::cout << "  " << name << ": " << std::fixed << std::setprecision(3)
+            << getMebibytes(memoryUsage.bytes) << "MiB ("
+            << std::setprecision(1) << 100.0 * overheadFraction
+            << "% overhead)\n";
+}
+
 void printSmoothingResultBase(const Smoothing::SmoothingResultBase& result) {
   std::cout << result.algorithmName << " smoothing result\n";
   printMeshQuality(result.meshQuality, "  ");
   std::cout << "  smoothing time: " << std::fixed << std::setprecision(3)
             << result.smoothingWallClockTimeInSeconds << "s\n";
+  if (!result.phaseTimes.isEmpty()) {
+    std::cout << "  phase times:\n";
+    for (const auto& phase : result.phaseTimes.getPhases()) {
+      std::cout << "    " << phase.name << ": " << std::fixed
+                << std::setprecision(3) << phase.timeInSeconds << "s ("
+                << std::setprecision(1)
+                << 100.0 * phase.timeInSeconds
+                       / std::max(result.smoothingWallClockTimeInSeconds,
+                                  std::numeric_limits<double>::min())
+                << "%)\n";
+      Common::printHardwareCounterValues(phase.hardwareCounterValues,
+                                         "      ");
+    }
+  }
+  if (result.peakScratchMemoryInBytes > 0) {
+    std::cout << "  peak scratch memory: " << std::fixed
+              << std::setprecision(3)
+              << getMebibytes(result.peakScratchMemoryInBytes) << "MiB\n";
+  }
+  if (!result.eventCounts.isZero()) {
+    std::cout << "  event counts:\n";
+    for (std::size_t eventIndex = 0; eventIndex < Utility::numberOfEvents;
+         ++eventIndex) {
+      const auto event = static_cast<Utility::Event>(eventIndex);
+      std::cout << "    " << Utility::getEventName(event) << ": "
+                << result.eventCounts.get(event) << "\n";
+    }
+  }
 }
+
+// Write the given optional value or the given replacement if not set.
+template <typename T>
+void writeOptional(const std::optional<T>& value,
+                   const std::string_view replacement,
+                   std::ostream& outputStream) {
+  if (value.has_value()) {
+    outputStream << value.value();
+  } else {
+    outputStream << replacement;
+  }
+}
+
+// Derive the path of a result file from the given initial mesh path by
+// replacing "_initial.mesh" with the given suffix.
+std::string getResultFilePath(const std::filesystem::path& initialMeshPath,
+                              const std::string& suffix) {
+  auto pathString = initialMeshPath.string();
+  const auto index = pathString.find("_initial.mesh");
+  Utility::throwExceptionIfTrue(std::string::npos == index,
+                                "File has not the expected name pattern.");
+  return pathString.erase(index) + suffix;
+}
+
+// Restores the format flags and the precision of a stream on destruction.
+class StreamFormatRestorer final {
+public:
+  explicit StreamFormatRestorer(std::ostream& outputStream)
+    : outputStream(outputStream)
+    , flags(outputStream.flags())
+    , precision(outputStream.precision()) {}
+
+  StreamFormatRestorer(const StreamFormatRestorer&) = delete;
+  StreamFormatRestorer& operator=(const StreamFormatRestorer&) = delete;
+
+  ~StreamFormatRestorer() {
+    outputStream.flags(flags);
+    outputStream.precision(precision);
+  }
+
+private:
+  std::ostream& outputStream;
+  const std::ios_base::fmtflags flags;
+  const std::streamsize precision;
+};
 }  // namespace
 
 void Common::printInitialMeshInformation(const Mesh::PolygonalMesh& mesh) {
@@ -131,6 +230,50 @@ void Common::printInitialMeshInformation(const Mesh::PolygonalMesh& mesh) {
   printMeshQuality(meshQuality, "  ");
 }
 
+void Common::printMeshMemoryUsage(const Mesh::PolygonalMesh& mesh) {
+  const auto memoryUsage = mesh.getMemoryUsage();
+  std::cout << "Mesh memory usage:\n";
+  printMemoryUsage("nodes", memoryUsage.nodes);
+  printMemoryUsage("polygons", memoryUsage.polygons);
+  printMemoryUsage("fixed node indices", memoryUsage.fixedNodeIndices);
+  printMemoryUsage("non fixed node indices", memoryUsage.nonFixedNodeIndices);
+  printMemoryUsage("fixed polygon flags", memoryUsage.fixedPolygonFlags);
+  printMemoryUsage("edge connected nodes", memoryUsage.edgeConnectedNodes);
+  printMemoryUsage("attached polygons", memoryUsage.attachedPolygons);
+  printMemoryUsage("neighbor polygons", memoryUsage.neighborPolygons);
+  printMemoryUsage("total", memoryUsage.getTotal());
+}
+
+void Common::printHardwareCounterValues(
+    const Utility::HardwareCounterValues& values,
+    const std::string& indentation) {
+  if (values.isEmpty()) {
+    return;
+  }
+  std::cout << indentation;
+  bool isFirst = true;
+  for (std::size_t counterIndex = 0;
+       counterIndex < Utility::numberOfHardwareCounters; ++counterIndex) {
+    const auto counter = static_cast<Utility::HardwareCounter>(counterIndex);
+    const auto& value = values.get(counter);
+    if (value.has_value()) {
+      std::cout << (isFirst ? "" : ", ")
+                << Utility::getHardwareCounterName(counter) << "="
+                << value.value();
+      isFirst = false;
+    }
+  }
+  const auto& cycles = values.get(Utility::HardwareCounter::Cycles);
+  const auto& instructions =
+      values.get(Utility::HardwareCounter::Instructions);
+  if (cycles.has_value() && instructions.has_value() && cycles.value() > 0) {
+    std::cout << ", IPC=" << std::fixed << std::setprecision(2)
+              << static_cast<double>(instructions.value())
+                     / static_cast<double>(cycles.value());
+  }
+  std::cout << std::defaultfloat << "\n";
+}
+
 void Common::printSmoothingResult(const Smoothing::SmoothingResult& result) {
   printSmoothingResultBase(result);
   std::cout << "  iterations: " << result.iterations << "\n";
@@ -142,14 +285,88 @@ void Common::printSmoothingResult(const Smoothing::GetmeResult& result) {
             << result.getmeSequentialIterations << "\n";
 }
 
+void Common::printSmoothingResult(
+    const Smoothing::MultilevelGetmeResult& result) {
+  printSmoothingResultBase(result);
+  std::cout << "  coarse levels: " << result.numberOfCoarseLevels << " ("
+            << result.coarseLevelsWallClockTimeInSeconds << "s)\n";
+  std::cout << "  iterations: " << result.getmeSimultaneousIterations << "/"
+            << result.getmeSequentialIterations << "\n";
+}
+
+void Common::writeConvergenceHistoryAsJsonLines(
+    const Smoothing::SmoothingResultBase& result,
+    std::ostream& outputStream) {
+  const StreamFormatRestorer formatRestorer(outputStream);
+  outputStream << std::defaultfloat
+               << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (const auto& record : result.convergenceHistory) {
+    outputStream << "{\"iteration\":" << record.iteration
+                 << ",\"qMin\":" << record.qMin << ",\"qMinStar\":";
+    writeOptional(record.qMinStar, "null", outputStream);
+    outputStream << ",\"qMean\":" << record.qMean
+                 << ",\"maxNodeRelocationDistance\":"
+                 << record.maxNodeRelocationDistance
+                 << ",\"numberOfInvalidElementNodeResets\":";
+    writeOptional(record.numberOfInvalidElementNodeResets, "null",
+                  outputStream);
+    outputStream << ",\"elapsedWallClockTimeInSeconds\":"
+                 << record.elapsedWallClockTimeInSeconds << "}\n";
+  }
+}
+
+void Common::writeConvergenceHistoryAsCsv(
+    const Smoothing::SmoothingResultBase& result,
+    std::ostream& outputStream) {
+  const StreamFormatRestorer formatRestorer(outputStream);
+  outputStream << "iteration,qMin,qMinStar,qMean,maxNodeRelocationDistance,"
+                  "numberOfInvalidElementNodeResets,"
+                  "elapsedWallClockTimeInSeconds\n"
+               << std::defaultfloat
+               << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (const auto& record : result.convergenceHistory) {
+    outputStream << record.iteration << "," << record.qMin << ",";
+    writeOptional(record.qMinStar, "", outputStream);
+    outputStream << "," << record.qMean << ","
+                 << record.maxNodeRelocationDistance << ",";
+    writeOptional(record.numberOfInvalidElementNodeResets, "", outputStream);
+    outputStream << "," << record.elapsedWallClockTimeInSeconds << "\n";
+  }
+}
+
+void Common::writeConvergenceHistory(
+    const Smoothing::SmoothingResultBase& result,
+    const std::filesystem::path& filePath) {
+  const auto extension = filePath.extension();
+  Utility::throwExceptionIfFalse(
+      extension == ".jsonl" || extension == ".csv",
+      "Convergence history file extension must be .jsonl or .csv.");
+  std::ofstream outputStream(filePath);
+  Utility::throwExceptionIfFalse(outputStream.is_open(),
+                                 "Cannot open convergence history file.");
+  if (extension == ".jsonl") {
+    writeConvergenceHistoryAsJsonLines(result, outputStream);
+  } else {
+    writeConvergenceHistoryAsCsv(result, outputStream);
+  }
+}
+
 void Common::writeResultMesh(const Mesh::PolygonalMesh& mesh,
                              const std::filesystem::path& initialMeshPath,
                              const std::string& meshName) {
-  auto pathString = initialMeshPath.string();
-  const auto index = pathString.find("_initial.mesh");
-  Utility::throwExceptionIfTrue(std::string::npos == index,
-                                "File has not the expected name pattern.");
-  pathString = pathString.erase(index) + "_" + meshName + ".mesh";
+  const auto pathString =
+      getResultFilePath(initialMeshPath, "_" + meshName + ".mesh");
   std::cout << "Writing result mesh file " << pathString << "\n";
   Mesh::writeMeshFile(mesh, pathString);
 }
+
+void Common::writeResultConvergenceHistory(
+    const Smoothing::SmoothingResultBase& result,
+    const std::filesystem::path& initialMeshPath,
+    const std::string& meshName,
+    const std::string& extension) {
+  const auto pathString = getResultFilePath(
+      initialMeshPath, "_" + meshName + "_history" + extension);
+  std::cout << "Writing convergence history file " << pathString << "\n";
+  writeConvergenceHistory(result, pathString);
+}
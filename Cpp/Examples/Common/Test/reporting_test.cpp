@@ -0,0 +1,191 @@
+/*
+Unit tests for the reporting functions of the examples.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Common/reporting.h"
+
+#include "Smoothing/convergence_history.h"
+#include "Smoothing/smoothing_result.h"
+#include "Testdata/meshes.h"
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+// Get a result with a complete record and a record without q_min* and
+// without number of resets.
+Smoothing::SmoothingResult getResultWithConvergenceHistory() {
+  const Smoothing::ConvergenceHistory convergenceHistory = {
+      {1, 0.25, 0.5, 0.75, 0.1, 3, 0.125},
+      {2, 1.0 / 3.0, std::nullopt, 2.0 / 3.0, 1.0e-7, std::nullopt, 0.25}};
+  return Smoothing::SmoothingResult("Test", Testdata::getMixedSampleMesh(),
+                                    0.25, 2, convergenceHistory);
+}
+
+std::vector<std::string> splitLines(const std::string& text) {
+  std::vector<std::string> lines;
+  std::istringstream inputStream(text);
+  std::string line;
+  while (std::getline(inputStream, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+std::vector<std::string> splitCsvLine(const std::string& line) {
+  std::vector<std::string> fields;
+  std::istringstream inputStream(line);
+  std::string field;
+  while (std::getline(inputStream, field, ',')) {
+    fields.push_back(field);
+  }
+  // A trailing empty field is not returned by getline.
+  if (!line.empty() && line.back() == ',') {
+    fields.emplace_back();
+  }
+  return fields;
+}
+
+// Parse a flat JSON object with numeric or null values into a name to value
+// map.
+std::map<std::string, std::string> parseJsonObject(const std::string& line) {
+  EXPECT_EQ('{', line.front());
+  EXPECT_EQ('}', line.back());
+  std::map<std::string, std::string> members;
+  for (const auto& member : splitCsvLine(line.substr(1, line.size() - 2))) {
+    const auto separatorIndex = member.find(':');
+    EXPECT_NE(std::string::npos, separatorIndex);
+    const auto name = member.substr(0, separatorIndex);
+    EXPECT_EQ('"', name.front());
+    EXPECT_EQ('"', name.back());
+    members[name.substr(1, name.size() - 2)] =
+        member.substr(separatorIndex + 1);
+  }
+  return members;
+}
+}  // namespace
+
+TEST(Reporting, writeConvergenceHistoryAsJsonLines) {
+  const auto result = getResultWithConvergenceHistory();
+  std::ostringstream outputStream;
+
+  Common::writeConvergenceHistoryAsJsonLines(result, outputStream);
+
+  const auto lines = splitLines(outputStream.str());
+  ASSERT_EQ(2, lines.size());
+  const auto first = parseJsonObject(lines.at(0));
+  EXPECT_EQ(7, first.size());
+  EXPECT_EQ("1", first.at("iteration"));
+  EXPECT_EQ(0.25, std::stod(first.at("qMin")));
+  EXPECT_EQ(0.5, std::stod(first.at("qMinStar")));
+  EXPECT_EQ(0.75, std::stod(first.at("qMean")));
+  EXPECT_EQ(0.1, std::stod(first.at("maxNodeRelocationDistance")));
+  EXPECT_EQ("3", first.at("numberOfInvalidElementNodeResets"));
+  EXPECT_EQ(0.125, std::stod(first.at("elapsedWallClockTimeInSeconds")));
+  const auto second = parseJsonObject(lines.at(1));
+  EXPECT_EQ(7, second.size());
+  EXPECT_EQ("2", second.at("iteration"));
+  // Values are written with round trip precision.
+  EXPECT_EQ(1.0 / 3.0, std::stod(second.at("qMin")));
+  EXPECT_EQ("null", second.at("qMinStar"));
+  EXPECT_EQ(2.0 / 3.0, std::stod(second.at("qMean")));
+  EXPECT_EQ(1.0e-7, std::stod(second.at("maxNodeRelocationDistance")));
+  EXPECT_EQ("null", second.at("numberOfInvalidElementNodeResets"));
+}
+
+TEST(Reporting, writeConvergenceHistoryAsCsv) {
+  const auto result = getResultWithConvergenceHistory();
+  std::ostringstream outputStream;
+
+  Common::writeConvergenceHistoryAsCsv(result, outputStream);
+
+  const auto lines = splitLines(outputStream.str());
+  ASSERT_EQ(3, lines.size());
+  const std::vector<std::string> expectedHeader = {
+      "iteration",
+      "qMin",
+      "qMinStar",
+      "qMean",
+      "maxNodeRelocationDistance",
+      "numberOfInvalidElementNodeResets",
+      "elapsedWallClockTimeInSeconds"};
+  EXPECT_EQ(expectedHeader, splitCsvLine(lines.at(0)));
+  const auto first = splitCsvLine(lines.at(1));
+  ASSERT_EQ(7, first.size());
+  EXPECT_EQ("1", first.at(0));
+  EXPECT_EQ(0.5, std::stod(first.at(2)));
+  EXPECT_EQ("3", first.at(5));
+  const auto second = splitCsvLine(lines.at(2));
+  ASSERT_EQ(7, second.size());
+  EXPECT_EQ("2", second.at(0));
+  EXPECT_EQ(1.0 / 3.0, std::stod(second.at(1)));
+  EXPECT_TRUE(second.at(2).empty());
+  EXPECT_EQ(2.0 / 3.0, std::stod(second.at(3)));
+  EXPECT_TRUE(second.at(5).empty());
+  EXPECT_EQ(0.25, std::stod(second.at(6)));
+}
+
+TEST(Reporting, writeConvergenceHistoryRestoresStreamFormat) {
+  const auto result = getResultWithConvergenceHistory();
+  std::ostringstream outputStream;
+  outputStream << std::fixed << std::setprecision(2);
+  const auto flags = outputStream.flags();
+
+  Common::writeConvergenceHistoryAsJsonLines(result, outputStream);
+  Common::writeConvergenceHistoryAsCsv(result, outputStream);
+
+  EXPECT_EQ(flags, outputStream.flags());
+  EXPECT_EQ(2, outputStream.precision());
+  // Fixed notation of the caller does not truncate small values.
+  const std::string smallValue = "9.9999999999999995e-08";
+  EXPECT_NE(std::string::npos, outputStream.str().find(smallValue));
+}
+
+TEST(Reporting, writeConvergenceHistory) {
+  const auto result = getResultWithConvergenceHistory();
+  const auto filePath =
+      std::filesystem::temp_directory_path() / "getme_history_test.csv";
+
+  Common::writeConvergenceHistory(result, filePath);
+
+  std::ifstream inputStream(filePath);
+  std::ostringstream fileContent;
+  fileContent << inputStream.rdbuf();
+  std::ostringstream expectedContent;
+  Common::writeConvergenceHistoryAsCsv(result, expectedContent);
+  EXPECT_EQ(expectedContent.str(), fileContent.str());
+  inputStream.close();
+  std::filesystem::remove(filePath);
+}
+
+TEST(Reporting, writeConvergenceHistory_throwIfExtensionInvalid) {
+  const auto result = getResultWithConvergenceHistory();
+  const auto filePath =
+      std::filesystem::temp_directory_path() / "getme_history.txt";
+
+  EXPECT_ANY_THROW(Common::writeConvergenceHistory(result, filePath));
+}
@@ -39,6 +39,7 @@ int main(int argc, char* argv[]) {
   const auto initialMesh = Mesh::readMeshFile(meshFilePath);
   std::cout << "\n\nExample: " << fileName << "\n";
   Common::printInitialMeshInformation(initialMesh);
+  Common::printMeshMemoryUsage(initialMesh);
 
   // Set algorithm parameters.
   const Smoothing::SmartLaplaceConfig smartLaplaceConfig;
@@ -21,22 +21,65 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #include "Common/reporting.h"
 #include "Common/smoothing_headers.h"
+#include "Utility/tracing.h"
 
 #include <filesystem>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace {
+// Parse the optional argument --convergence-history=jsonl|csv. Returns the
+// file extension of the history files, which is empty if no history is
+// requested. Returns nothing if the arguments are invalid.
+std::optional<std::string> parseConvergenceHistoryExtension(const int argc,
+                                                            char* argv[]) {
+  if (argc == 1) {
+    return std::string();
+  }
+  const std::string_view prefix = "--convergence-history=";
+  const std::string_view argument(argv[1]);
+  if (argc > 2 || !argument.starts_with(prefix)) {
+    return std::nullopt;
+  }
+  const auto format = argument.substr(prefix.size());
+  if (format != "jsonl" && format != "csv") {
+    return std::nullopt;
+  }
+  return "." + std::string(format);
+}
+}  // namespace
 
 int main(int argc, char* argv[]) {
   const auto dataPath = std::filesystem::path(argv[0]).parent_path();
+  const auto historyExtension = parseConvergenceHistoryExtension(argc, argv);
+  if (!historyExtension) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--convergence-history=jsonl|csv]\n";
+    return 1;
+  }
+  const bool writeHistory = !historyExtension->empty();
 
   std::cout << "\nThis program demonstrates smoothing of distorted single\n"
                "element type finite element meshes of an involute gear.\n"
                "Cf. Section 7.4.2 of the book Vartziotis, Wipper: The GETMe\n"
                "Mesh Smoothing Framework, CRC Press, 2018.\n";
 
-  // Set algorithm parameters.
-  const Smoothing::SmartLaplaceConfig smartLaplaceConfig;
+  if constexpr (Utility::isTracingEnabled) {
+    Utility::setTraceThreadName("main");
+    Utility::startTracing();
+  }
+
+  // Set algorithm parameters. If requested, the convergence history is
+  // recorded for each iteration.
+  Smoothing::SmartLaplaceConfig smartLaplaceConfig;
   const std::size_t maxNumberOfPolygonNodes = 4;
-  const Smoothing::GetmeConfig getmeConfig(maxNumberOfPolygonNodes);
+  Smoothing::GetmeConfig getmeConfig(maxNumberOfPolygonNodes);
+  if (writeHistory) {
+    smartLaplaceConfig.convergenceHistoryInterval = 1;
+    getmeConfig.getmeSimultaneousConfig.convergenceHistoryInterval = 1;
+  }
 
   // Loop over mesh types.
   for (const auto fileName :
@@ -45,6 +88,13 @@ int main(int argc, char* argv[]) {
     const auto initialMesh = Mesh::readMeshFile(meshFilePath);
     std::cout << "\nExample: " << fileName << "\n";
     Common::printInitialMeshInformation(initialMesh);
+    Common::printMeshMemoryUsage(initialMesh);
+    if (writeHistory) {
+      // Each GETMe sequential record requires a pass over all polygons.
+      // Hence, one record per number of polygons iterations is taken.
+      getmeConfig.getmeSequentialConfig.convergenceHistoryInterval =
+          initialMesh.getNumberOfPolygons();
+    }
 
     // Smooth mesh using smart Laplace.
     const auto smartLaplaceResult =
@@ -52,15 +102,31 @@ int main(int argc, char* argv[]) {
     Common::printSmoothingResult(smartLaplaceResult);
     Common::writeResultMesh(smartLaplaceResult.mesh, meshFilePath,
                             "smart_laplace");
+    if (writeHistory) {
+      Common::writeResultConvergenceHistory(smartLaplaceResult, meshFilePath,
+                                            "smart_laplace", *historyExtension);
+    }
 
     // Smooth mesh using GETMe.
     const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
     Common::printSmoothingResult(getmeResult);
     Common::writeResultMesh(getmeResult.mesh, meshFilePath, "getme");
+    if (writeHistory) {
+      Common::writeResultConvergenceHistory(getmeResult, meshFilePath, "getme",
+                                            *historyExtension);
+    }
   }
 
   std::cout << "\nResults can be visualized by using the Matlab function "
                "showallmeshes.\n\n";
 
+  if constexpr (Utility::isTracingEnabled) {
+    Utility::stopTracing();
+    const auto traceFilePath = dataPath / "gearmeshes_trace.json";
+    Utility::writeChromeTrace(traceFilePath);
+    std::cout << "Trace written to " << traceFilePath.string()
+              << ". It can be opened in Perfetto.\n\n";
+  }
+
   return 0;
 }
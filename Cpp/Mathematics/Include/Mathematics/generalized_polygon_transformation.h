@@ -22,10 +22,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 // GETMe book.
 #pragma once
 
+#include "Mathematics/vector2d.h"
+
 #include <vector>
 
 namespace Mathematics {
-class Vector2D;
+class NodeCoordinateArrays;
 class Polygon;
 
 class GeneralizedPolygonTransformation final {
@@ -44,10 +46,19 @@ public:
 
   double getTheta() const { return theta; }
 
-  // Apply the transformation to the given polygon and nodes.
+  // Apply the transformation to the given polygon and nodes. Computations are
+  // carried out in the precision of the given nodes. Instantiated for float
+  // and double.
+  template <typename Scalar>
+  std::vector<BasicVector2D<Scalar>> getNodesOfTransformedPolygon(
+      const Polygon& polygon,
+      const std::vector<BasicVector2D<Scalar>>& nodes) const;
+
+  // Apply the transformation to the given polygon and structure of arrays
+  // nodes. Same result as the interleaved nodes variant.
   std::vector<Vector2D> getNodesOfTransformedPolygon(
       const Polygon& polygon,
-      const std::vector<Vector2D>& nodes) const;
+      const NodeCoordinateArrays& nodes) const;
 
   // Compute eigenvalues according to Lemma 5.2 of the GETMe book.
   std::vector<double> getEigenvalues(
@@ -0,0 +1,136 @@
+/*
+Structure of arrays representation of planar node coordinates.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Mathematics/vector2d.h"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Mathematics {
+// Minimal allocator returning memory aligned to the given byte boundary. Used
+// for coordinate arrays to allow aligned vector loads.
+template <typename T, std::size_t Alignment = 64>
+class AlignedAllocator {
+public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() = default;
+
+  template <typename U>
+  explicit AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+  T* allocate(const std::size_t numberOfElements) {
+    return static_cast<T*>(::operator new(numberOfElements * sizeof(T),
+                                          std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T* pointer, const std::size_t) {
+    ::operator delete(pointer, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const {
+    return true;
+  }
+};
+
+// Node coordinates stored as two separate aligned arrays for the x and the y
+// coordinates. Alternative to std::vector<Vector2D>, which stores coordinates
+// interleaved. Allows streaming a single coordinate and vectorized access to
+// consecutive nodes.
+class NodeCoordinateArrays final {
+public:
+  using CoordinateArray = std::vector<double, AlignedAllocator<double>>;
+
+  NodeCoordinateArrays() = default;
+
+  // Constructor for the given number of nodes initialized to (0,0).
+  explicit NodeCoordinateArrays(const std::size_t numberOfNodes);
+
+  // Conversion constructor for interleaved nodes.
+  explicit NodeCoordinateArrays(const std::vector<Vector2D>& nodes);
+
+  std::size_t getNumberOfNodes() const { return xCoordinates.size(); }
+
+  double getX(const std::size_t nodeIndex) const {
+    return xCoordinates.at(nodeIndex);
+  }
+
+  double getY(const std::size_t nodeIndex) const {
+    return yCoordinates.at(nodeIndex);
+  }
+
+  Vector2D getNode(const std::size_t nodeIndex) const {
+    return Vector2D(xCoordinates.at(nodeIndex), yCoordinates.at(nodeIndex));
+  }
+
+  void setNode(const std::size_t nodeIndex, const Vector2D& node) {
+    xCoordinates.at(nodeIndex) = node.getX();
+    yCoordinates.at(nodeIndex) = node.getY();
+  }
+
+  const CoordinateArray& getXCoordinates() const { return xCoordinates; }
+
+  const CoordinateArray& getYCoordinates() const { return yCoordinates; }
+
+  CoordinateArray& getMutableXCoordinates() { return xCoordinates; }
+
+  CoordinateArray& getMutableYCoordinates() { return yCoordinates; }
+
+  // Set coordinates from interleaved nodes. Reuses allocated memory if
+  // possible.
+  void assign(const std::vector<Vector2D>& nodes);
+
+  // Convert to interleaved nodes.
+  std::vector<Vector2D> toVector2DNodes() const;
+
+  // Write nodes to the given interleaved nodes vector of matching size.
+  void copyTo(std::vector<Vector2D>& nodes) const;
+
+  bool operator==(const NodeCoordinateArrays& other) const = default;
+
+private:
+  CoordinateArray xCoordinates;
+  CoordinateArray yCoordinates;
+};
+
+// Uniform node access for interleaved and structure of arrays node storage.
+// Allows implementing node based algorithms once for both storage types.
+template <typename Scalar>
+inline const BasicVector2D<Scalar>& getNode(
+    const std::vector<BasicVector2D<Scalar>>& nodes,
+    const std::size_t nodeIndex) {
+  return nodes.at(nodeIndex);
+}
+
+inline Vector2D getNode(const NodeCoordinateArrays& nodes,
+                        const std::size_t nodeIndex) {
+  return nodes.getNode(nodeIndex);
+}
+}  // namespace Mathematics
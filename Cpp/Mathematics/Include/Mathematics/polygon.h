@@ -25,34 +25,80 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 // indices. The vector of nodes has to be defined separately.
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace Mathematics {
 class Polygon final {
 public:
-  explicit Polygon(const std::vector<std::size_t>& nodeIndices);
+  // Maximal number of node indices stored inline without heap allocation.
+  // Covers the largest polygons, i.e. dodecagons, of the Platonic meshes.
+  static constexpr std::size_t inlineCapacity = 12;
 
-  const std::vector<std::size_t>& getNodeIndices() const { return nodeIndices; }
+  explicit Polygon(const std::vector<std::size_t>& nodeIndices);
+  Polygon(const Polygon& other);
+  Polygon(Polygon&& other) noexcept;
+  Polygon& operator=(const Polygon& other);
+  Polygon& operator=(Polygon&& other) noexcept;
+  ~Polygon();
+
+  std::span<const std::size_t> getNodeIndices() const {
+    return {getNodeIndicesData(), numberOfNodes};
+  }
 
-  std::size_t getNumberOfNodes() const { return nodeIndices.size(); }
+  std::size_t getNumberOfNodes() const { return numberOfNodes; }
 
   std::size_t getNodeIndex(const std::size_t nodeNumber) const {
-    return nodeIndices.at(nodeNumber);
+    return at(nodeNumber);
   }
 
   std::size_t getPredecessorNodeIndex(const std::size_t nodeNumber) const {
-    return nodeIndices.at(nodeNumber == 0 ? nodeIndices.size() - 1
-                                          : nodeNumber - 1);
+    return at(nodeNumber == 0 ? numberOfNodes - 1 : nodeNumber - 1);
   }
 
   std::size_t getSuccessorNodeIndex(const std::size_t nodeNumber) const {
-    return nodeIndices.at(
-        nodeNumber == nodeIndices.size() - 1 ? 0 : nodeNumber + 1);
+    return at(nodeNumber == numberOfNodes - 1 ? 0 : nodeNumber + 1);
   }
 
-  bool operator==(const Polygon& other) const = default;
+  // Heap memory of polygons with more than inlineCapacity nodes.
+  std::size_t getHeapCapacityInBytes() const {
+    return isStoredInline() ? 0 : numberOfNodes * sizeof(std::size_t);
+  }
+
+  bool operator==(const Polygon& other) const;
 
 private:
-  std::vector<std::size_t> nodeIndices;
+  bool isStoredInline() const { return numberOfNodes <= inlineCapacity; }
+
+  const std::size_t* getNodeIndicesData() const {
+    return isStoredInline() ? inlineNodeIndices.data() : heapNodeIndices;
+  }
+
+  // Take over the node indices of the given polygon, which is left without
+  // nodes. Requires this polygon to own no heap memory.
+  void takeNodeIndices(Polygon& other);
+
+  // Bounds checked node index access analogous to std::vector::at.
+  std::size_t at(const std::size_t nodeNumber) const {
+    if (nodeNumber >= numberOfNodes) {
+      throw std::out_of_range("Polygon node number out of range.");
+    }
+    return getNodeIndicesData()[nodeNumber];
+  }
+
+  std::size_t numberOfNodes;
+
+  // Storage is selected by the number of nodes. Hence, the heap fallback does
+  // not enlarge polygons stored inline.
+  union {
+    // Node indices of polygons with at most inlineCapacity nodes. Unused
+    // entries are zero.
+    std::array<std::size_t, inlineCapacity> inlineNodeIndices{};
+    // Owned node indices of polygons with more than inlineCapacity nodes.
+    std::size_t* heapNodeIndices;
+  };
 };
 }  // namespace Mathematics
@@ -21,11 +21,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "Mathematics/vector2d.h"
+
+#include <span>
 #include <vector>
 
 namespace Mathematics {
+class NodeCoordinateArrays;
 class Polygon;
-class Vector2D;
 
 // Get nodes of a counter clockwise oriented regular polygon with centroid
 // (0,0) and radius 1.0.
@@ -33,6 +36,27 @@ std::vector<Vector2D> getNodesOfRegularPolygon(const std::size_t numberOfNodes);
 
 // Compute mean ratio quality number for the given polygon and nodes according
 // to Equation 2.6 of the GETMe book. Returns a quality number in [0,1] for
-// valid polygons and -1 for invalid polygons.
-double getMeanRatio(const Polygon& polygon, const std::vector<Vector2D>& nodes);
+// valid polygons and -1 for invalid polygons. The computation is carried out
+// in the precision of the given nodes. Instantiated for float and double.
+template <typename Scalar>
+Scalar getMeanRatio(const Polygon& polygon,
+                    const std::vector<BasicVector2D<Scalar>>& nodes);
+
+// Compute mean ratio quality number for the given polygon and structure of
+// arrays nodes. Same result as the interleaved nodes variant.
+double getMeanRatio(const Polygon& polygon, const NodeCoordinateArrays& nodes);
+
+// Compute the summand of the mean ratio quality number of Equation 2.6 of the
+// GETMe book belonging to the corner with the given polygon node number. It
+// only depends on the node of the corner and its predecessor and successor
+// nodes. Returns -1 for inverted corners.
+double getMeanRatioCornerSummand(const Polygon& polygon,
+                                 const std::size_t polygonNodeNumber,
+                                 const std::vector<Vector2D>& nodes);
+
+// Combine the corner summands of a polygon given in node order to its mean
+// ratio quality number. Yields the same result as getMeanRatio. Since all
+// corner summands of a triangle coincide, only the first one is used for
+// triangles.
+double getMeanRatioFromCornerSummands(std::span<const double> cornerSummands);
 }  // namespace Mathematics
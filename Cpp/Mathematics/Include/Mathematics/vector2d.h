@@ -22,55 +22,76 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 namespace Mathematics {
-class Vector2D final {
+// Vector for the given floating point scalar type. Use the Vector2D alias for
+// double precision vectors.
+template <typename Scalar>
+class BasicVector2D final {
 public:
-  Vector2D(const double x, const double y) : x(x), y(y){};
+  BasicVector2D(const Scalar x, const Scalar y) : x(x), y(y){};
 
-  double getX() const { return x; }
+  // Explicit conversion between vectors of different precision.
+  template <typename OtherScalar>
+  explicit BasicVector2D(const BasicVector2D<OtherScalar>& other)
+    : x(static_cast<Scalar>(other.getX()))
+    , y(static_cast<Scalar>(other.getY())){};
 
-  double getY() const { return y; }
+  Scalar getX() const { return x; }
 
-  Vector2D operator+(const Vector2D& other) const {
-    return Vector2D(x + other.x, y + other.y);
+  Scalar getY() const { return y; }
+
+  BasicVector2D operator+(const BasicVector2D& other) const {
+    return BasicVector2D(x + other.x, y + other.y);
   }
 
-  void operator+=(const Vector2D& other) {
+  void operator+=(const BasicVector2D& other) {
     x += other.x;
     y += other.y;
   }
 
-  Vector2D operator-(const Vector2D& other) const {
-    return Vector2D(x - other.x, y - other.y);
+  BasicVector2D operator-(const BasicVector2D& other) const {
+    return BasicVector2D(x - other.x, y - other.y);
   }
 
-  void operator/=(const double divisor) {
+  void operator/=(const Scalar divisor) {
     x /= divisor;
     y /= divisor;
   }
 
-  bool operator==(const Vector2D& other) const = default;
+  bool operator==(const BasicVector2D& other) const = default;
 
-  inline friend Vector2D operator*(const double factor, const Vector2D& vector);
+  friend BasicVector2D operator*(const Scalar factor,
+                                 const BasicVector2D& vector) {
+    return BasicVector2D(factor * vector.x, factor * vector.y);
+  }
 
-  inline friend Vector2D operator/(const Vector2D& vector,
-                                   const double divisor);
+  friend BasicVector2D operator/(const BasicVector2D& vector,
+                                 const Scalar divisor) {
+    return BasicVector2D(vector.x / divisor, vector.y / divisor);
+  }
 
-  double getLengthSquared() const { return x * x + y * y; }
+  Scalar getLengthSquared() const { return x * x + y * y; }
 
-  double getLength() const { return std::sqrt(x * x + y * y); }
+  Scalar getLength() const { return std::sqrt(x * x + y * y); }
 
 private:
-  double x;
-  double y;
+  Scalar x;
+  Scalar y;
 };
 
-Vector2D operator*(const double factor, const Vector2D& vector) {
-  return Vector2D(factor * vector.x, factor * vector.y);
-}
-
-Vector2D operator/(const Vector2D& vector, const double divisor) {
-  return Vector2D(vector.x / divisor, vector.y / divisor);
+using Vector2D = BasicVector2D<double>;
+using Vector2DFloat = BasicVector2D<float>;
+
+// Convert vectors to the given target precision.
+template <typename TargetScalar, typename SourceScalar>
+void convertVectors(const std::vector<BasicVector2D<SourceScalar>>& source,
+                    std::vector<BasicVector2D<TargetScalar>>& target) {
+  target.clear();
+  target.reserve(source.size());
+  for (const auto& vector : source) {
+    target.emplace_back(vector);
+  }
 }
 }  // namespace Mathematics
@@ -23,10 +23,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mathematics/vector2d.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace Mathematics {
-class Vector2D;
 class BoundingBox;
 
 // Check if the given two vectors are equal up to tolerance (Euclidean norm).
@@ -47,4 +47,11 @@ BoundingBox getBoundingBox(const std::vector<Vector2D>& points);
 
 // Get random vector with maximal given Euclidean length.
 Vector2D getRandomVector(const double maxVectorLength);
+
+// Get random vector with maximal given Euclidean length, which only depends on
+// the given seed and counter. Allows reproducible parallel generation of
+// random vectors by using distinct counters.
+Vector2D getRandomVector(const double maxVectorLength,
+                         const std::uint64_t seed,
+                         const std::uint64_t counter);
 }  // namespace Mathematics
@@ -22,8 +22,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 // GETMe book.
 #include "Mathematics/generalized_polygon_transformation.h"
 
+#include "Mathematics/node_coordinate_arrays.h"
 #include "Mathematics/polygon.h"
 #include "Mathematics/vector2d.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
 
 #include <algorithm>
@@ -32,6 +34,36 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <numbers>
 
 namespace Mathematics {
+namespace {
+template <typename Scalar, typename Nodes>
+std::vector<BasicVector2D<Scalar>> getNodesOfTransformedPolygonForNodes(
+    const Polygon& polygon,
+    const Nodes& nodes,
+    const Scalar c1,
+    const Scalar c2,
+    const Scalar c3) {
+  Utility::countEvent(Utility::Event::PolygonTransformation);
+  std::vector<BasicVector2D<Scalar>> transformedNodes(
+      polygon.getNumberOfNodes(), BasicVector2D<Scalar>(Scalar(0), Scalar(0)));
+  for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
+       ++nodeNumber) {
+    const auto predecessorNode =
+        getNode(nodes, polygon.getPredecessorNodeIndex(nodeNumber));
+    const auto node = getNode(nodes, polygon.getNodeIndex(nodeNumber));
+    const auto successorNode =
+        getNode(nodes, polygon.getSuccessorNodeIndex(nodeNumber));
+    // Compute new node position according to Equation 5.26 of the GETMe book.
+    const BasicVector2D<Scalar> rotatedDifference(
+        successorNode.getY() - predecessorNode.getY(),
+        predecessorNode.getX() - successorNode.getX());
+    transformedNodes.at(nodeNumber) = c1 * rotatedDifference
+                                      + c2 * (predecessorNode + successorNode)
+                                      + c3 * node;
+  }
+  return transformedNodes;
+}
+}  // namespace
+
 GeneralizedPolygonTransformation::GeneralizedPolygonTransformation(
     const double lambda,
     const double theta)
@@ -54,27 +86,30 @@ GeneralizedPolygonTransformation::GeneralizedPolygonTransformation(
           ? std::numbers::pi / 4.0
           : std::numbers::pi / static_cast<double>(numberOfPolygonNodes)){};
 
+template <typename Scalar>
+std::vector<BasicVector2D<Scalar>>
+GeneralizedPolygonTransformation::getNodesOfTransformedPolygon(
+    const Polygon& polygon,
+    const std::vector<BasicVector2D<Scalar>>& nodes) const {
+  return getNodesOfTransformedPolygonForNodes(
+      polygon, nodes, static_cast<Scalar>(c1), static_cast<Scalar>(c2),
+      static_cast<Scalar>(c3));
+}
+
+template std::vector<Vector2D>
+GeneralizedPolygonTransformation::getNodesOfTransformedPolygon(
+    const Polygon& polygon,
+    const std::vector<Vector2D>& nodes) const;
+template std::vector<Vector2DFloat>
+GeneralizedPolygonTransformation::getNodesOfTransformedPolygon(
+    const Polygon& polygon,
+    const std::vector<Vector2DFloat>& nodes) const;
+
 std::vector<Vector2D>
 GeneralizedPolygonTransformation::getNodesOfTransformedPolygon(
     const Polygon& polygon,
-    const std::vector<Vector2D>& nodes) const {
-  std::vector<Vector2D> transformedNodes(polygon.getNumberOfNodes(),
-                                         Vector2D(0.0, 0.0));
-  for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
-       ++nodeNumber) {
-    const auto& predecessorNode =
-        nodes.at(polygon.getPredecessorNodeIndex(nodeNumber));
-    const auto& node = nodes.at(polygon.getNodeIndex(nodeNumber));
-    const auto& successorNode =
-        nodes.at(polygon.getSuccessorNodeIndex(nodeNumber));
-    // Compute new node position according to Equation 5.26 of the GETMe book.
-    transformedNodes.at(nodeNumber) =
-        c1
-            * Vector2D(successorNode.getY() - predecessorNode.getY(),
-                       predecessorNode.getX() - successorNode.getX())
-        + c2 * (predecessorNode + successorNode) + c3 * node;
-  }
-  return transformedNodes;
+    const NodeCoordinateArrays& nodes) const {
+  return getNodesOfTransformedPolygonForNodes(polygon, nodes, c1, c2, c3);
 }
 
 std::vector<double> GeneralizedPolygonTransformation::getEigenvalues(
@@ -0,0 +1,58 @@
+/*
+Structure of arrays representation of planar node coordinates.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mathematics/node_coordinate_arrays.h"
+
+#include "Utility/exception_handling.h"
+
+namespace Mathematics {
+NodeCoordinateArrays::NodeCoordinateArrays(const std::size_t numberOfNodes)
+  : xCoordinates(numberOfNodes, 0.0), yCoordinates(numberOfNodes, 0.0) {}
+
+NodeCoordinateArrays::NodeCoordinateArrays(const std::vector<Vector2D>& nodes) {
+  assign(nodes);
+}
+
+void NodeCoordinateArrays::assign(const std::vector<Vector2D>& nodes) {
+  const std::size_t numberOfNodes = nodes.size();
+  xCoordinates.resize(numberOfNodes);
+  yCoordinates.resize(numberOfNodes);
+  for (std::size_t nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+    xCoordinates[nodeIndex] = nodes[nodeIndex].getX();
+    yCoordinates[nodeIndex] = nodes[nodeIndex].getY();
+  }
+}
+
+std::vector<Vector2D> NodeCoordinateArrays::toVector2DNodes() const {
+  std::vector<Vector2D> nodes(getNumberOfNodes(), Vector2D(0.0, 0.0));
+  copyTo(nodes);
+  return nodes;
+}
+
+void NodeCoordinateArrays::copyTo(std::vector<Vector2D>& nodes) const {
+  Utility::throwExceptionIfFalse(nodes.size() == getNumberOfNodes(),
+                                 "Non matching number of nodes.");
+  for (std::size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+    nodes[nodeIndex] =
+        Vector2D(xCoordinates[nodeIndex], yCoordinates[nodeIndex]);
+  }
+}
+}  // namespace Mathematics
@@ -24,17 +24,93 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Utility/exception_handling.h"
 
-#include <unordered_set>
+#include <algorithm>
+
+namespace {
+// Check for duplicate node indices. Uses pairwise comparisons without
+// allocating memory for small polygons.
+bool containsDuplicates(const std::vector<std::size_t>& nodeIndices) {
+  if (nodeIndices.size() <= Mathematics::Polygon::inlineCapacity) {
+    for (auto first = nodeIndices.begin(); first != nodeIndices.end();
+         ++first) {
+      if (std::find(first + 1, nodeIndices.end(), *first)
+          != nodeIndices.end()) {
+        return true;
+      }
+    }
+    return false;
+  }
+  auto sortedNodeIndices = nodeIndices;
+  std::ranges::sort(sortedNodeIndices);
+  return std::ranges::adjacent_find(sortedNodeIndices)
+         != sortedNodeIndices.end();
+}
+}  // namespace
 
 namespace Mathematics {
 Polygon::Polygon(const std::vector<std::size_t>& nodeIndices)
-  : nodeIndices(nodeIndices) {
+  : numberOfNodes(nodeIndices.size()) {
   Utility::throwExceptionIfFalse(nodeIndices.size() >= 3,
                                  "Polygon must consist of at least 3 nodes.");
-  const std::unordered_set<std::size_t> uniqueNodeIndices(nodeIndices.begin(),
-                                                          nodeIndices.end());
-  Utility::throwExceptionIfFalse(
-      nodeIndices.size() == uniqueNodeIndices.size(),
+  Utility::throwExceptionIfTrue(
+      containsDuplicates(nodeIndices),
       "Duplicate node indices are not allowed in polygonal elements.");
+  if (isStoredInline()) {
+    std::ranges::copy(nodeIndices, inlineNodeIndices.begin());
+  } else {
+    heapNodeIndices = new std::size_t[numberOfNodes];
+    std::ranges::copy(nodeIndices, heapNodeIndices);
+  }
+}
+
+Polygon::Polygon(const Polygon& other) : numberOfNodes(other.numberOfNodes) {
+  if (isStoredInline()) {
+    inlineNodeIndices = other.inlineNodeIndices;
+  } else {
+    heapNodeIndices = new std::size_t[numberOfNodes];
+    std::ranges::copy(other.getNodeIndices(), heapNodeIndices);
+  }
+}
+
+Polygon::Polygon(Polygon&& other) noexcept : numberOfNodes(0) {
+  takeNodeIndices(other);
+}
+
+Polygon& Polygon::operator=(const Polygon& other) {
+  if (this != &other) {
+    *this = Polygon(other);
+  }
+  return *this;
+}
+
+Polygon& Polygon::operator=(Polygon&& other) noexcept {
+  if (this != &other) {
+    if (!isStoredInline()) {
+      delete[] heapNodeIndices;
+    }
+    takeNodeIndices(other);
+  }
+  return *this;
+}
+
+Polygon::~Polygon() {
+  if (!isStoredInline()) {
+    delete[] heapNodeIndices;
+  }
+}
+
+bool Polygon::operator==(const Polygon& other) const {
+  return std::ranges::equal(getNodeIndices(), other.getNodeIndices());
+}
+
+void Polygon::takeNodeIndices(Polygon& other) {
+  numberOfNodes = other.numberOfNodes;
+  if (isStoredInline()) {
+    inlineNodeIndices = other.inlineNodeIndices;
+  } else {
+    heapNodeIndices = other.heapNodeIndices;
+  }
+  other.numberOfNodes = 0;
+  other.inlineNodeIndices = {};
 }
 }  // namespace Mathematics
@@ -21,10 +21,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #include "Mathematics/polygon_algorithms.h"
 
+#include "Mathematics/node_coordinate_arrays.h"
 #include "Mathematics/polygon.h"
 #include "Mathematics/vector2d.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
 
+#include <algorithm>
 #include <cmath>
 #include <numbers>
 
@@ -42,14 +45,34 @@ std::vector<Mathematics::Vector2D> Mathematics::getNodesOfRegularPolygon(
 }
 
 namespace {
+// Entries a and b of the matrix W=[a,a;b,-b] of the reference triangle of a
+// regular polygon with the given number of nodes. Since they only depend on
+// the number of nodes, they are computed once per polygon.
+template <typename Scalar>
+struct ReferenceTriangleEntries final {
+  explicit ReferenceTriangleEntries(const std::size_t numberOfPolygonNodes)
+    : a(std::cos(getRegularPolygonAngle(numberOfPolygonNodes)) - Scalar(1))
+    , b(std::sin(getRegularPolygonAngle(numberOfPolygonNodes))) {}
+
+  static Scalar getRegularPolygonAngle(const std::size_t numberOfPolygonNodes) {
+    return Scalar(2) * std::numbers::pi_v<Scalar>
+           / static_cast<Scalar>(numberOfPolygonNodes);
+  }
+
+  const Scalar a;
+  const Scalar b;
+};
+
 // Compute one summand of Equation (2.6) of the GETMe book:
 // q(E):=(2/numberOfPolygonNodes) sum_{0}^{numberOfPolygonNodes-1}
 // det(S_k)/trace(S_k^tS_k) with S_k:=D(T_k)W^{-1}. Here, zero based node
 // indices are used and m=2 is considered in the factor in front of the sum.
-double getMeanRatioSummand(const Mathematics::Polygon& polygon,
+// All computations are carried out in the given scalar precision.
+template <typename Scalar, typename Nodes>
+Scalar getMeanRatioSummand(const Mathematics::Polygon& polygon,
                            const std::size_t polygonNodeNumber,
-                           const std::vector<Mathematics::Vector2D>& nodes,
-                           const std::size_t numberOfPolygonNodes) {
+                           const Nodes& nodes,
+                           const ReferenceTriangleEntries<Scalar>& reference) {
   const std::size_t predecessorNodeIndex =
       polygon.getPredecessorNodeIndex(polygonNodeNumber);
   const std::size_t centerNodeIndex = polygon.getNodeIndex(polygonNodeNumber);
@@ -63,57 +86,112 @@ double getMeanRatioSummand(const Mathematics::Polygon& polygon,
   // successor node  :  [cos(2*pi/n); sin(2*pi/n)]
   // Matrix W: [successor-center, predecessor-center] =
   // [cos(2*pi/n)-1,cos(2*pi/n)-1;sin(2*pi/n),-sin(2*pi/n)] =: [a,a;b,-b]
-  const double regularPolygonAngle =
-      2.0 * std::numbers::pi / static_cast<double>(numberOfPolygonNodes);
-  const double a = std::cos(regularPolygonAngle) - 1.0;
-  const double b = std::sin(regularPolygonAngle);
+  const Scalar a = reference.a;
+  const Scalar b = reference.b;
+  const auto centerNode = Mathematics::getNode(nodes, centerNodeIndex);
   const auto diffSuccessorCenter =
-      nodes.at(successorNodeIndex) - nodes.at(centerNodeIndex);
+      Mathematics::getNode(nodes, successorNodeIndex) - centerNode;
   const auto diffPredecessorCenter =
-      nodes.at(predecessorNodeIndex) - nodes.at(centerNodeIndex);
+      Mathematics::getNode(nodes, predecessorNodeIndex) - centerNode;
 
   // Entries of the matrix D(T_k) := [successor-center, predecessor-center] are
   // [d11,d12; d21,d22].
-  const double d11 = diffSuccessorCenter.getX();
-  const double d12 = diffPredecessorCenter.getX();
-  const double d21 = diffSuccessorCenter.getY();
-  const double d22 = diffPredecessorCenter.getY();
+  const Scalar d11 = diffSuccessorCenter.getX();
+  const Scalar d12 = diffPredecessorCenter.getX();
+  const Scalar d21 = diffSuccessorCenter.getY();
+  const Scalar d22 = diffPredecessorCenter.getY();
 
   // Compute the determinant of S_k := D(T_k)*W^(-1), which is
   // det(S_k) = det(D(T_k))*(1/det(W)).
-  const double detS = (d12 * d21 - d11 * d22) / (2.0 * a * b);
-  if (detS < 0.0) {
-    return -1.0;
+  const Scalar detS = (d12 * d21 - d11 * d22) / (Scalar(2) * a * b);
+  if (detS < Scalar(0)) {
+    return Scalar(-1);
   }
-  const double trace =
-      ((d11 - d12) * (d11 - d12) + (d21 - d22) * (d21 - d22)) / (4.0 * b * b)
-      + ((d11 + d12) * (d11 + d12) + (d21 + d22) * (d21 + d22)) / (4.0 * a * a);
-  const double summand = detS / trace;
+  const Scalar trace =
+      ((d11 - d12) * (d11 - d12) + (d21 - d22) * (d21 - d22))
+          / (Scalar(4) * b * b)
+      + ((d11 + d12) * (d11 + d12) + (d21 + d22) * (d21 + d22))
+            / (Scalar(4) * a * a);
+  const Scalar summand = detS / trace;
   return summand;
 }
-}  // namespace
 
-double Mathematics::getMeanRatio(const Polygon& polygon,
-                                 const std::vector<Vector2D>& nodes) {
+template <typename Scalar, typename Nodes>
+Scalar getMeanRatioOfPolygon(const Mathematics::Polygon& polygon,
+                             const Nodes& nodes) {
   // Note: 1.0 will be enforced as exact upper bound to cut off numerical
   // inaccuracies.
+  Utility::countEvent(Utility::Event::MeanRatioEvaluation);
   const auto numberOfNodes = polygon.getNumberOfNodes();
   if (numberOfNodes == 3) {
     // Special case triangle: all node simplices are the same. Therefore it
-    // suffices to compute only one summand. Hence, no division by three.
-    const double summand =
-        getMeanRatioSummand(polygon, 0, nodes, numberOfNodes);
-    return summand < 0.0 ? -1.0 : std::min(1.0, 2.0 * summand);
+    // suffices to compute only one summand. Hence, no division by three. The
+    // constant number of nodes allows evaluating the reference entries at
+    // compile time.
+    const ReferenceTriangleEntries<Scalar> reference(3);
+    const Scalar summand =
+        getMeanRatioSummand<Scalar>(polygon, 0, nodes, reference);
+    return summand < Scalar(0) ? Scalar(-1)
+                               : std::min(Scalar(1), Scalar(2) * summand);
   } else {
-    double sum = 0.0;
+    const ReferenceTriangleEntries<Scalar> reference(numberOfNodes);
+    Scalar sum = Scalar(0);
     for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes; ++nodeNumber) {
-      const double summand =
-          getMeanRatioSummand(polygon, nodeNumber, nodes, numberOfNodes);
-      if (summand < 0.0) {
-        return -1.0;
+      const Scalar summand =
+          getMeanRatioSummand<Scalar>(polygon, nodeNumber, nodes, reference);
+      if (summand < Scalar(0)) {
+        return Scalar(-1);
       }
       sum += summand;
     }
-    return std::min(1.0, 2.0 * sum / static_cast<double>(numberOfNodes));
+    return std::min(Scalar(1),
+                    Scalar(2) * sum / static_cast<Scalar>(numberOfNodes));
+  }
+}
+}  // namespace
+
+template <typename Scalar>
+Scalar Mathematics::getMeanRatio(
+    const Polygon& polygon,
+    const std::vector<BasicVector2D<Scalar>>& nodes) {
+  return getMeanRatioOfPolygon<Scalar>(polygon, nodes);
+}
+
+template double Mathematics::getMeanRatio(const Polygon& polygon,
+                                          const std::vector<Vector2D>& nodes);
+template float Mathematics::getMeanRatio(
+    const Polygon& polygon,
+    const std::vector<Vector2DFloat>& nodes);
+
+double Mathematics::getMeanRatio(const Polygon& polygon,
+                                 const NodeCoordinateArrays& nodes) {
+  return getMeanRatioOfPolygon<double>(polygon, nodes);
+}
+
+double Mathematics::getMeanRatioCornerSummand(
+    const Polygon& polygon,
+    const std::size_t polygonNodeNumber,
+    const std::vector<Vector2D>& nodes) {
+  const ReferenceTriangleEntries<double> reference(polygon.getNumberOfNodes());
+  return getMeanRatioSummand<double>(polygon, polygonNodeNumber, nodes,
+                                     reference);
+}
+
+double Mathematics::getMeanRatioFromCornerSummands(
+    std::span<const double> cornerSummands) {
+  Utility::throwExceptionIfTrue(cornerSummands.size() < 3,
+                                "At least three corner summands required.");
+  // Same operations as in getMeanRatioOfPolygon to obtain identical results.
+  if (cornerSummands.size() == 3) {
+    const double summand = cornerSummands.front();
+    return summand < 0.0 ? -1.0 : std::min(1.0, 2.0 * summand);
+  }
+  double sum = 0.0;
+  for (const double summand : cornerSummands) {
+    if (summand < 0.0) {
+      return -1.0;
+    }
+    sum += summand;
   }
+  return std::min(1.0, 2.0 * sum / static_cast<double>(cornerSummands.size()));
 }
@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mathematics/vector2d_algorithms.h"
 
 #include "Mathematics/bounding_box.h"
+#include "Utility/counter_based_random.h"
 #include "Utility/exception_handling.h"
 
 #include <algorithm>
@@ -78,3 +79,17 @@ Mathematics::Vector2D Mathematics::getRandomVector(
   const double angle = distributionAngle(engine);
   return Vector2D(radius * std::cos(angle), radius * std::sin(angle));
 }
+
+Mathematics::Vector2D Mathematics::getRandomVector(
+    const double maxVectorLength,
+    const std::uint64_t seed,
+    const std::uint64_t counter) {
+  Utility::throwExceptionIfFalse(maxVectorLength > 0.0,
+                                 "Radius has to be > 0.0.");
+  // Each vector consumes two consecutive counter values.
+  const double radius =
+      maxVectorLength * Utility::getUniformRandomNumber(seed, 2 * counter);
+  const double angle = 2.0 * std::numbers::pi
+                       * Utility::getUniformRandomNumber(seed, 2 * counter + 1);
+  return Vector2D(radius * std::cos(angle), radius * std::sin(angle));
+}
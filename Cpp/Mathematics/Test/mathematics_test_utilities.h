@@ -21,12 +21,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "Mathematics/vector2d.h"
+
 #include <complex>
 #include <vector>
 
 namespace Mathematics {
 class Polygon;
-class Vector2D;
 }  // namespace Mathematics
 
 namespace MathematicsTestUtilities {
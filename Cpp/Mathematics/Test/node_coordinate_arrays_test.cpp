@@ -0,0 +1,99 @@
+/*
+Unit tests for the structure of arrays representation of node coordinates.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mathematics/node_coordinate_arrays.h"
+
+#include "Mathematics/generalized_polygon_transformation.h"
+#include "Mathematics/polygon.h"
+#include "Mathematics/polygon_algorithms.h"
+#include "Mathematics/vector2d_algorithms.h"
+#include "mathematics_test_utilities.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+TEST(NodeCoordinateArrays, conversion) {
+  const auto nodes = MathematicsTestUtilities::getSampleNodes();
+  const Mathematics::NodeCoordinateArrays nodeCoordinateArrays(nodes);
+
+  EXPECT_EQ(nodes.size(), nodeCoordinateArrays.getNumberOfNodes());
+  for (std::size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+    EXPECT_EQ(nodes.at(nodeIndex).getX(), nodeCoordinateArrays.getX(nodeIndex));
+    EXPECT_EQ(nodes.at(nodeIndex).getY(), nodeCoordinateArrays.getY(nodeIndex));
+    EXPECT_EQ(nodes.at(nodeIndex), nodeCoordinateArrays.getNode(nodeIndex));
+  }
+  EXPECT_EQ(nodes, nodeCoordinateArrays.toVector2DNodes());
+
+  std::vector<Mathematics::Vector2D> tooFewNodes(3, {0.0, 0.0});
+  EXPECT_ANY_THROW(nodeCoordinateArrays.copyTo(tooFewNodes));
+}
+
+TEST(NodeCoordinateArrays, setNodeAndAssign) {
+  Mathematics::NodeCoordinateArrays nodeCoordinateArrays(2);
+  EXPECT_EQ(Mathematics::Vector2D(0.0, 0.0), nodeCoordinateArrays.getNode(1));
+
+  nodeCoordinateArrays.setNode(1, {3.0, -2.0});
+  EXPECT_EQ(Mathematics::Vector2D(3.0, -2.0), nodeCoordinateArrays.getNode(1));
+  EXPECT_ANY_THROW(nodeCoordinateArrays.setNode(2, {0.0, 0.0}));
+
+  const auto nodes = MathematicsTestUtilities::getSampleNodes();
+  nodeCoordinateArrays.assign(nodes);
+  EXPECT_EQ(Mathematics::NodeCoordinateArrays(nodes), nodeCoordinateArrays);
+}
+
+TEST(NodeCoordinateArrays, alignment) {
+  const Mathematics::NodeCoordinateArrays nodeCoordinateArrays(
+      MathematicsTestUtilities::getSampleNodes());
+  const auto isAligned = [](const double* pointer) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % 64 == 0;
+  };
+
+  EXPECT_TRUE(isAligned(nodeCoordinateArrays.getXCoordinates().data()));
+  EXPECT_TRUE(isAligned(nodeCoordinateArrays.getYCoordinates().data()));
+}
+
+TEST(NodeCoordinateArrays, getMeanRatio) {
+  const auto nodes = MathematicsTestUtilities::getSampleNodes();
+  const Mathematics::NodeCoordinateArrays nodeCoordinateArrays(nodes);
+
+  for (std::size_t numberOfNodes = 3; numberOfNodes <= 10; ++numberOfNodes) {
+    const auto polygon = MathematicsTestUtilities::getPolygon(numberOfNodes);
+    EXPECT_EQ(Mathematics::getMeanRatio(polygon, nodes),
+              Mathematics::getMeanRatio(polygon, nodeCoordinateArrays));
+  }
+}
+
+TEST(NodeCoordinateArrays, getNodesOfTransformedPolygon) {
+  const auto nodes = MathematicsTestUtilities::getSampleNodes();
+  const Mathematics::NodeCoordinateArrays nodeCoordinateArrays(nodes);
+
+  for (std::size_t numberOfNodes = 3; numberOfNodes <= 10; ++numberOfNodes) {
+    const auto polygon = MathematicsTestUtilities::getPolygon(numberOfNodes);
+    const Mathematics::GeneralizedPolygonTransformation transformation(
+        numberOfNodes);
+    EXPECT_EQ(
+        transformation.getNodesOfTransformedPolygon(polygon, nodes),
+        transformation.getNodesOfTransformedPolygon(polygon,
+                                                    nodeCoordinateArrays));
+  }
+}
@@ -88,3 +88,44 @@ TEST(PolygonAlgorithms, getMeanRatio) {
     EXPECT_NEAR(expectedMeanRatioValue, meanRatioValue, tolerance);
   }
 }
+
+TEST(PolygonAlgorithms, getMeanRatio_singlePrecision) {
+  const auto nodes = MathematicsTestUtilities::getSampleNodes();
+  std::vector<Mathematics::Vector2DFloat> floatNodes;
+  Mathematics::convertVectors(nodes, floatNodes);
+
+  for (std::size_t numberOfNodes = 3; numberOfNodes <= 10; ++numberOfNodes) {
+    const auto polygon = MathematicsTestUtilities::getPolygon(numberOfNodes);
+    const double meanRatioValue = Mathematics::getMeanRatio(polygon, nodes);
+    const float floatMeanRatioValue =
+        Mathematics::getMeanRatio(polygon, floatNodes);
+    const double tolerance = 1.0e-5;
+
+    EXPECT_NEAR(meanRatioValue, floatMeanRatioValue, tolerance);
+  }
+}
+
+TEST(PolygonAlgorithms, getMeanRatioFromCornerSummands) {
+  const std::vector<double> twoSummands{0.5, 0.5};
+  EXPECT_THROW(Mathematics::getMeanRatioFromCornerSummands(twoSummands),
+               Utility::GenericException);
+
+  // Invalid sample polygons and valid regular polygons.
+  const auto sampleNodes = MathematicsTestUtilities::getSampleNodes();
+  for (std::size_t numberOfNodes = 3; numberOfNodes <= 10; ++numberOfNodes) {
+    const auto polygon = MathematicsTestUtilities::getPolygon(numberOfNodes);
+    const auto regularPolygonNodes =
+        Mathematics::getNodesOfRegularPolygon(numberOfNodes);
+    for (const auto& nodes : {sampleNodes, regularPolygonNodes}) {
+      std::vector<double> cornerSummands;
+      for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes;
+           ++nodeNumber) {
+        cornerSummands.push_back(
+            Mathematics::getMeanRatioCornerSummand(polygon, nodeNumber, nodes));
+      }
+
+      EXPECT_EQ(Mathematics::getMeanRatio(polygon, nodes),
+                Mathematics::getMeanRatioFromCornerSummands(cornerSummands));
+    }
+  }
+}
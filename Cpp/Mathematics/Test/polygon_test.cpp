@@ -23,6 +23,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 TEST(Polygon, constructorThrows) {
@@ -38,7 +41,7 @@ TEST(Polygon, basicGetters) {
   const std::vector<std::size_t> nodeIndices{17, 0, 12, 14, 5, 3, 1};
   const Mathematics::Polygon polygon(nodeIndices);
 
-  EXPECT_EQ(nodeIndices, polygon.getNodeIndices());
+  EXPECT_TRUE(std::ranges::equal(nodeIndices, polygon.getNodeIndices()));
   EXPECT_EQ(nodeIndices.size(), polygon.getNumberOfNodes());
 }
 
@@ -67,3 +70,48 @@ TEST(Polygon, equalsOperator) {
   EXPECT_NE(first, second);
   EXPECT_NE(first, third);
 }
+
+TEST(Polygon, heapStorage) {
+  std::vector<std::size_t> nodeIndices(Mathematics::Polygon::inlineCapacity
+                                       + 5);
+  std::iota(nodeIndices.rbegin(), nodeIndices.rend(), 3);
+  const Mathematics::Polygon polygon(nodeIndices);
+
+  EXPECT_TRUE(std::ranges::equal(nodeIndices, polygon.getNodeIndices()));
+  EXPECT_EQ(nodeIndices.size(), polygon.getNumberOfNodes());
+  EXPECT_EQ(nodeIndices.front(),
+            polygon.getSuccessorNodeIndex(nodeIndices.size() - 1));
+  EXPECT_ANY_THROW(polygon.getNodeIndex(nodeIndices.size()));
+
+  nodeIndices.at(7) = nodeIndices.at(15);
+  EXPECT_ANY_THROW(Mathematics::Polygon{nodeIndices});
+}
+
+TEST(Polygon, copyAndMove) {
+  std::vector<std::size_t> heapNodeIndices(Mathematics::Polygon::inlineCapacity
+                                           + 5);
+  std::iota(heapNodeIndices.begin(), heapNodeIndices.end(), 0);
+  const Mathematics::Polygon heapPolygon(heapNodeIndices);
+  const Mathematics::Polygon inlinePolygon({4, 7, 2, 9});
+
+  Mathematics::Polygon polygon(heapPolygon);
+  EXPECT_EQ(heapPolygon, polygon);
+  polygon = inlinePolygon;
+  EXPECT_EQ(inlinePolygon, polygon);
+  EXPECT_EQ(0, polygon.getHeapCapacityInBytes());
+  polygon = heapPolygon;
+  EXPECT_EQ(heapPolygon, polygon);
+  EXPECT_EQ(heapNodeIndices.size() * sizeof(std::size_t),
+            polygon.getHeapCapacityInBytes());
+
+  Mathematics::Polygon movedPolygon(std::move(polygon));
+  EXPECT_EQ(heapPolygon, movedPolygon);
+  movedPolygon = Mathematics::Polygon(inlinePolygon);
+  EXPECT_EQ(inlinePolygon, movedPolygon);
+}
+
+TEST(Polygon, size) {
+  // Node index storage and the number of nodes.
+  EXPECT_EQ((Mathematics::Polygon::inlineCapacity + 1) * sizeof(std::size_t),
+            sizeof(Mathematics::Polygon));
+}
@@ -26,6 +26,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+
 TEST(Vector2DAlgorithms, areEqual_singleVector) {
   const Mathematics::Vector2D vector1(1.0, -2.0);
   const Mathematics::Vector2D vector2(0.9, -1.99);
@@ -96,4 +98,20 @@ TEST(Vector2DAlgorithms, getRandomVector) {
 TEST(Vector2DAlgorithms, getRandomVector_invalidMaxLength) {
   EXPECT_ANY_THROW(Mathematics::getRandomVector(0.0));
   EXPECT_ANY_THROW(Mathematics::getRandomVector(-1.0));
+  EXPECT_ANY_THROW(Mathematics::getRandomVector(0.0, 1, 2));
+}
+
+TEST(Vector2DAlgorithms, getRandomVector_seeded) {
+  const double maxVectorLength = 10.0;
+  const std::uint64_t seed = 7;
+  Mathematics::Vector2D lastVector(maxVectorLength, maxVectorLength);
+  for (std::uint64_t counter = 0; counter < 100; ++counter) {
+    const auto vector =
+        Mathematics::getRandomVector(maxVectorLength, seed, counter);
+    EXPECT_LE(vector.getLength(), maxVectorLength);
+    EXPECT_NE(lastVector, vector);
+    EXPECT_EQ(Mathematics::getRandomVector(maxVectorLength, seed, counter),
+              vector);
+    lastVector = vector;
+  }
 }
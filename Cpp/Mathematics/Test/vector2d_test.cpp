@@ -23,6 +23,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 TEST(Vector2D, coordinateGetters) {
   const double x = 1.43;
   const double y = -4.23;
@@ -109,3 +111,17 @@ TEST(Vector2D, getLength) {
 
   EXPECT_EQ(expectedLengthSquared, vector.getLength());
 }
+
+TEST(Vector2D, precisionConversion) {
+  const std::vector<Mathematics::Vector2D> vectors = {{1.0, -2.0},
+                                                      {0.1, 3.5}};
+  std::vector<Mathematics::Vector2DFloat> floatVectors;
+  const std::vector<Mathematics::Vector2DFloat> expectedFloatVectors = {
+      {1.0f, -2.0f}, {0.1f, 3.5f}};
+
+  Mathematics::convertVectors(vectors, floatVectors);
+
+  EXPECT_EQ(expectedFloatVectors, floatVectors);
+  EXPECT_EQ(Mathematics::Vector2D(0.5, -2.0),
+            Mathematics::Vector2D(Mathematics::Vector2DFloat(0.5f, -2.0f)));
+}
@@ -0,0 +1,106 @@
+/*
+Cache of polygon mean ratio corner summands.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Mathematics/vector2d.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Mesh {
+class PolygonalMesh;
+
+// Stores the mean ratio corner summands of all mesh polygons. Since a corner
+// summand only depends on the corner node and its two neighbors, moving a
+// single node changes only three summands of each attached polygon. This
+// allows updating the mean ratio of polygons with many nodes by recomputing
+// only the affected corners. For polygons with fewer nodes than
+// minNumberOfNodesWithCornerSummands, only the mean ratio is stored, since
+// recomputing it is cheaper than tracking affected corners. Results are
+// identical to Mathematics::getMeanRatio.
+class MeanRatioCornerCache final {
+public:
+  static constexpr std::size_t minNumberOfNodesWithCornerSummands = 8;
+
+  // Returns true if the mesh contains polygons, for which corner summands are
+  // cached. Otherwise, using the cache has no benefit.
+  static bool isBeneficialFor(const PolygonalMesh& mesh);
+
+  // Compute the cached values of all polygons for the current mesh nodes.
+  // The mesh must outlive the cache and its topology must not change.
+  explicit MeanRatioCornerCache(const PolygonalMesh& mesh);
+
+  // Recompute the cached values for the given mesh reusing the allocated
+  // storage. Same requirements as for the constructor apply.
+  void reset(const PolygonalMesh& newMesh);
+
+  // Get the mean ratio of the given polygon based on the cached values.
+  double getMeanRatio(const std::size_t polygonIndex) const;
+
+  // Set the nodes, whose positions differ from the cached state. Replaces the
+  // previously set moved nodes.
+  void setMovedNodes(std::span<const std::size_t> movedNodeIndices);
+
+  // Compute the mean ratio of the given polygon for the given nodes, which
+  // differ from the cached state only at the moved nodes. Only corners
+  // adjacent to moved nodes are recomputed. The resulting values are staged
+  // and can be stored by acceptStagedValues. The cached state is not changed.
+  double computeMeanRatioForMovedNodes(
+      const std::size_t polygonIndex,
+      const std::vector<Mathematics::Vector2D>& nodes);
+
+  // Store the values staged by the last call of computeMeanRatioForMovedNodes
+  // for the given polygon.
+  void acceptStagedValues(const std::size_t polygonIndex);
+
+  // Recompute the values of all corners adjacent to moved nodes for the given
+  // nodes. Only polygons attached to moved nodes are visited. Afterwards, the
+  // cached state matches the given nodes.
+  void updateForMovedNodes(const std::vector<Mathematics::Vector2D>& nodes);
+
+  // Get the accumulated capacity of all cached data in bytes.
+  std::size_t getCapacityInBytes() const;
+
+private:
+  double getMeanRatio(const std::size_t polygonIndex,
+                      const std::vector<double>& sourceValues) const;
+  // Recompute values of corners adjacent to moved nodes or of all corners.
+  void recomputeValues(const std::size_t polygonIndex,
+                       const bool recomputeAllCorners,
+                       const std::vector<Mathematics::Vector2D>& nodes,
+                       std::vector<double>& targetValues) const;
+
+  const PolygonalMesh* mesh = nullptr;
+  // Values of polygon i are stored at [valueOffsets[i], valueOffsets[i+1]).
+  std::vector<std::size_t> valueOffsets;
+  std::vector<double> values;
+  std::vector<double> stagedValues;
+  // Dense flags of the moved nodes, whose indices are given in the list.
+  std::vector<std::uint8_t> isNodeMoved;
+  std::vector<std::size_t> movedNodeIndices;
+  // Flags to visit polygons attached to multiple moved nodes only once. All
+  // flags are cleared after each update.
+  std::vector<std::uint8_t> isPolygonUpdated;
+};
+}  // namespace Mesh
@@ -0,0 +1,66 @@
+/*
+Coarsening of polygonal meshes by node aggregation.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Coarse meshes are used by multilevel smoothing to propagate node movements
+// over larger distances than a single smoothing iteration on the fine mesh.
+#pragma once
+
+#include "Mathematics/vector2d.h"
+#include "Mesh/polygonal_mesh.h"
+
+#include <vector>
+
+namespace Mesh {
+// Coarse mesh obtained by node aggregation. Each node of the finer mesh is
+// assigned to exactly one aggregate, which is a node of the coarse mesh.
+struct CoarsenedMesh final {
+  // The coarse mesh. Its node positions are the centroids of the aggregated
+  // finer mesh nodes. Its polygons are the agglomerates of the finer mesh
+  // polygons spanning at least three aggregates. Aggregates of fixed nodes
+  // and aggregates not contained in any coarse polygon are fixed.
+  PolygonalMesh mesh;
+
+  // For the finer mesh node with index k, aggregateIndices[k] gives the index
+  // of the coarse mesh node it has been assigned to.
+  std::vector<std::size_t> aggregateIndices;
+};
+
+// Coarsen the given mesh by greedy aggregation. Unaggregated nodes in index
+// order form an aggregate with all unaggregated edge connected nodes. Fixed
+// and non fixed nodes are never combined within one aggregate.
+CoarsenedMesh coarsenMesh(const PolygonalMesh& mesh);
+
+// Restrict the given vectors of the finer mesh nodes, e.g. node positions or
+// displacements, to the coarse mesh by computing the aggregate means.
+std::vector<Mathematics::Vector2D> restrictToCoarseMesh(
+    const std::vector<Mathematics::Vector2D>& finerNodeVectors,
+    const CoarsenedMesh& coarsenedMesh);
+
+// Prolongate the given coarse node displacements to the nodes of the finer
+// mesh the coarse mesh has been derived from. The displacement of a non fixed
+// finer node is the mean of the displacements of its own aggregate and the
+// aggregates of its edge connected nodes. This smooths the piecewise constant
+// aggregate displacements. Fixed nodes are not displaced.
+std::vector<Mathematics::Vector2D> prolongateDisplacements(
+    const std::vector<Mathematics::Vector2D>& coarseDisplacements,
+    const CoarsenedMesh& coarsenedMesh,
+    const PolygonalMesh& finerMesh);
+}  // namespace Mesh
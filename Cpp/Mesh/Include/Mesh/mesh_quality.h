@@ -38,7 +38,10 @@ public:
   // Compute mesh quality based on provided mean ratio numbers.
   // Terminates computation preliminary, if there is at least one
   // invalid element and determineNumberOfInvalidElements = false.
-  explicit MeshQuality(const std::vector<double>& elementMeanRatioValues,
+  // Instantiated for float and double mean ratio numbers, which are summed up
+  // in double precision.
+  template <typename Scalar>
+  explicit MeshQuality(const std::vector<Scalar>& elementMeanRatioValues,
                        const bool determineNumberOfInvalidElements);
 
   // Get minimal mean ratio quality of all mesh elements.
@@ -24,11 +24,26 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mathematics/polygon.h"
 #include "Mathematics/vector2d.h"
+#include "Utility/memory_usage.h"
 
 #include <unordered_set>
 #include <vector>
 
 namespace Mesh {
+// Heap memory of the data structures of a polygonal mesh.
+struct PolygonalMeshMemoryUsage final {
+  Utility::MemoryUsage nodes;
+  Utility::MemoryUsage polygons;
+  Utility::MemoryUsage fixedNodeIndices;
+  Utility::MemoryUsage nonFixedNodeIndices;
+  Utility::MemoryUsage fixedPolygonFlags;
+  Utility::MemoryUsage edgeConnectedNodes;
+  Utility::MemoryUsage attachedPolygons;
+  Utility::MemoryUsage neighborPolygons;
+
+  Utility::MemoryUsage getTotal() const;
+};
+
 class PolygonalMesh final {
 public:
   // Constructor of mesh by nodes an polygons. Fixed node indices indicate
@@ -83,6 +98,11 @@ public:
     return maximalNumberOfPolygonNodes;
   }
 
+  // Get the heap memory of the node, polygon and topology data. Polygon node
+  // indices are payload, whereas inline storage of unused node indices is
+  // overhead.
+  PolygonalMeshMemoryUsage getMemoryUsage() const;
+
 private:
   // Helper functions used for data initialization.
   void setNonFixedNodes();
@@ -21,12 +21,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "Mathematics/vector2d.h"
+
+#include <cstdint>
 #include <filesystem>
 #include <vector>
 
 namespace Mathematics {
 class Polygon;
-class Vector2D;
 }  // namespace Mathematics
 
 namespace Mesh {
@@ -39,11 +41,14 @@ void writeMeshFile(const PolygonalMesh& mesh,
 
 PolygonalMesh readMeshFile(const std::filesystem::path& infilePath);
 
-// Assign mean ratio numbers of given polygons to given vector.
+// Assign mean ratio numbers of given polygons to given vector. Quality numbers
+// are computed in the precision of the given nodes. Instantiated for float and
+// double.
+template <typename Scalar>
 void computeMeanRatioQualityNumberOfPolygons(
     const std::vector<Mathematics::Polygon>& polygons,
-    const std::vector<Mathematics::Vector2D>& nodes,
-    std::vector<double>& meanRatioQualityNumbers);
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    std::vector<Scalar>& meanRatioQualityNumbers);
 
 // Compute mean ratio numbers of given polygons.
 std::vector<double> computeMeanRatioQualityNumberOfPolygons(
@@ -61,4 +66,12 @@ bool areEqual(const PolygonalMesh& first,
 // parameter. Distortion usually does not preserve mesh validity.
 PolygonalMesh distortNodesLocally(const PolygonalMesh& mesh,
                                   const double maxDistortionRadius);
+
+// Seeded variant of local random node distortion. Nodes are distorted in
+// parallel and the distortion of a node only depends on the seed and the node
+// index. Hence, results are reproducible for a given seed, independent of the
+// number of threads used.
+PolygonalMesh distortNodesLocally(const PolygonalMesh& mesh,
+                                  const double maxDistortionRadius,
+                                  const std::uint64_t seed);
 }  // namespace Mesh
@@ -0,0 +1,207 @@
+/*
+Cache of polygon mean ratio corner summands.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mesh/mean_ratio_corner_cache.h"
+
+#include "Mathematics/polygon.h"
+#include "Mathematics/polygon_algorithms.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Utility/event_counters.h"
+#include "Utility/memory_usage.h"
+
+#include <algorithm>
+#include <bitset>
+
+namespace {
+// Polygons with more nodes are always recomputed completely.
+constexpr std::size_t maxMaskedCorners = 64;
+
+bool hasCornerSummands(const Mathematics::Polygon& polygon) {
+  return polygon.getNumberOfNodes()
+         >= Mesh::MeanRatioCornerCache::minNumberOfNodesWithCornerSummands;
+}
+
+std::size_t getNumberOfStoredValues(const Mathematics::Polygon& polygon) {
+  return hasCornerSummands(polygon) ? polygon.getNumberOfNodes() : 1;
+}
+
+// Mark corners adjacent to moved nodes. Each node is adjacent to its own
+// corner and the corners of its predecessor and successor. For polygons
+// exceeding the mask size, an arbitrary bit is set if a node was moved.
+std::bitset<maxMaskedCorners> getAffectedCornerMask(
+    const Mathematics::Polygon& polygon,
+    const std::vector<std::uint8_t>& isNodeMoved) {
+  std::bitset<maxMaskedCorners> isAffectedCorner;
+  const auto numberOfNodes = polygon.getNumberOfNodes();
+  for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes; ++nodeNumber) {
+    if (!isNodeMoved.at(polygon.getNodeIndex(nodeNumber))) {
+      continue;
+    }
+    if (numberOfNodes > maxMaskedCorners) {
+      isAffectedCorner.set(0);
+      break;
+    }
+    isAffectedCorner.set((nodeNumber + numberOfNodes - 1) % numberOfNodes);
+    isAffectedCorner.set(nodeNumber);
+    isAffectedCorner.set((nodeNumber + 1) % numberOfNodes);
+  }
+  return isAffectedCorner;
+}
+}  // namespace
+
+namespace Mesh {
+bool MeanRatioCornerCache::isBeneficialFor(const PolygonalMesh& mesh) {
+  return mesh.getMaximalNumberOfPolygonNodes()
+         >= minNumberOfNodesWithCornerSummands;
+}
+
+MeanRatioCornerCache::MeanRatioCornerCache(const PolygonalMesh& mesh) {
+  reset(mesh);
+}
+
+void MeanRatioCornerCache::reset(const PolygonalMesh& newMesh) {
+  mesh = &newMesh;
+  isNodeMoved.assign(newMesh.getNumberOfNodes(), 0);
+  movedNodeIndices.clear();
+  isPolygonUpdated.assign(newMesh.getNumberOfPolygons(), 0);
+  const auto& polygons = newMesh.getPolygons();
+  valueOffsets.clear();
+  valueOffsets.reserve(polygons.size() + 1);
+  valueOffsets.push_back(0);
+  for (const auto& polygon : polygons) {
+    valueOffsets.push_back(valueOffsets.back()
+                           + getNumberOfStoredValues(polygon));
+  }
+  values.resize(valueOffsets.back());
+  const bool recomputeAllCorners = true;
+  for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+       ++polygonIndex) {
+    recomputeValues(polygonIndex, recomputeAllCorners, newMesh.getNodes(),
+                    values);
+  }
+  stagedValues = values;
+}
+
+double MeanRatioCornerCache::getMeanRatio(
+    const std::size_t polygonIndex) const {
+  return getMeanRatio(polygonIndex, values);
+}
+
+void MeanRatioCornerCache::setMovedNodes(
+    std::span<const std::size_t> newMovedNodeIndices) {
+  for (const auto nodeIndex : movedNodeIndices) {
+    isNodeMoved.at(nodeIndex) = 0;
+  }
+  movedNodeIndices.assign(newMovedNodeIndices.begin(),
+                          newMovedNodeIndices.end());
+  for (const auto nodeIndex : movedNodeIndices) {
+    isNodeMoved.at(nodeIndex) = 1;
+  }
+}
+
+double MeanRatioCornerCache::computeMeanRatioForMovedNodes(
+    const std::size_t polygonIndex,
+    const std::vector<Mathematics::Vector2D>& nodes) {
+  Utility::countEvent(Utility::Event::CachedMeanRatioEvaluation);
+  const auto begin = valueOffsets.at(polygonIndex);
+  const auto end = valueOffsets.at(polygonIndex + 1);
+  std::copy(values.begin() + begin, values.begin() + end,
+            stagedValues.begin() + begin);
+  const bool recomputeAllCorners = false;
+  recomputeValues(polygonIndex, recomputeAllCorners, nodes, stagedValues);
+  return getMeanRatio(polygonIndex, stagedValues);
+}
+
+void MeanRatioCornerCache::acceptStagedValues(const std::size_t polygonIndex) {
+  const auto begin = valueOffsets.at(polygonIndex);
+  const auto end = valueOffsets.at(polygonIndex + 1);
+  std::copy(stagedValues.begin() + begin, stagedValues.begin() + end,
+            values.begin() + begin);
+}
+
+void MeanRatioCornerCache::updateForMovedNodes(
+    const std::vector<Mathematics::Vector2D>& nodes) {
+  const bool recomputeAllCorners = false;
+  for (const auto nodeIndex : movedNodeIndices) {
+    for (const auto polygonIndex :
+         mesh->getAttachedPolygonIndices(nodeIndex)) {
+      if (isPolygonUpdated.at(polygonIndex)) {
+        continue;
+      }
+      isPolygonUpdated.at(polygonIndex) = 1;
+      recomputeValues(polygonIndex, recomputeAllCorners, nodes, values);
+    }
+  }
+  for (const auto nodeIndex : movedNodeIndices) {
+    for (const auto polygonIndex :
+         mesh->getAttachedPolygonIndices(nodeIndex)) {
+      isPolygonUpdated.at(polygonIndex) = 0;
+    }
+  }
+}
+
+std::size_t MeanRatioCornerCache::getCapacityInBytes() const {
+  return Utility::getMemoryUsage(valueOffsets).bytes
+         + Utility::getMemoryUsage(values).bytes
+         + Utility::getMemoryUsage(stagedValues).bytes
+         + Utility::getMemoryUsage(isNodeMoved).bytes
+         + Utility::getMemoryUsage(movedNodeIndices).bytes
+         + Utility::getMemoryUsage(isPolygonUpdated).bytes;
+}
+
+double MeanRatioCornerCache::getMeanRatio(
+    const std::size_t polygonIndex,
+    const std::vector<double>& sourceValues) const {
+  const auto begin = valueOffsets.at(polygonIndex);
+  const auto end = valueOffsets.at(polygonIndex + 1);
+  if (end - begin == 1) {
+    return sourceValues.at(begin);
+  }
+  return Mathematics::getMeanRatioFromCornerSummands(
+      std::span<const double>(sourceValues).subspan(begin, end - begin));
+}
+
+void MeanRatioCornerCache::recomputeValues(
+    const std::size_t polygonIndex,
+    const bool recomputeAllCorners,
+    const std::vector<Mathematics::Vector2D>& nodes,
+    std::vector<double>& targetValues) const {
+  const auto& polygon = mesh->getPolygons().at(polygonIndex);
+  const auto offset = valueOffsets.at(polygonIndex);
+  const auto isAffectedCorner =
+      recomputeAllCorners ? std::bitset<maxMaskedCorners>().set()
+                          : getAffectedCornerMask(polygon, isNodeMoved);
+  if (isAffectedCorner.none()) {
+    return;
+  }
+  if (!hasCornerSummands(polygon)) {
+    targetValues.at(offset) = Mathematics::getMeanRatio(polygon, nodes);
+    return;
+  }
+  const auto numberOfNodes = polygon.getNumberOfNodes();
+  for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes; ++nodeNumber) {
+    if (numberOfNodes > maxMaskedCorners || isAffectedCorner.test(nodeNumber)) {
+      targetValues.at(offset + nodeNumber) =
+          Mathematics::getMeanRatioCornerSummand(polygon, nodeNumber, nodes);
+    }
+  }
+}
+}  // namespace Mesh
@@ -0,0 +1,178 @@
+/*
+Coarsening of polygonal meshes by node aggregation.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mesh/mesh_coarsening.h"
+
+#include "Mathematics/polygon.h"
+#include "Utility/exception_handling.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+constexpr std::size_t unassigned = std::numeric_limits<std::size_t>::max();
+
+// Assign each node to an aggregate. Returns the number of aggregates.
+std::size_t aggregateNodes(const Mesh::PolygonalMesh& mesh,
+                           std::vector<std::size_t>& aggregateIndices) {
+  const auto& fixedNodeIndices = mesh.getFixedNodeIndices();
+  aggregateIndices.assign(mesh.getNumberOfNodes(), unassigned);
+  std::size_t numberOfAggregates = 0;
+  for (std::size_t nodeIndex = 0; nodeIndex < mesh.getNumberOfNodes();
+       ++nodeIndex) {
+    if (aggregateIndices.at(nodeIndex) != unassigned) {
+      continue;
+    }
+    const bool isFixedNode = fixedNodeIndices.contains(nodeIndex);
+    aggregateIndices.at(nodeIndex) = numberOfAggregates;
+    for (const auto neighborNodeIndex :
+         mesh.getIndicesOfEdgeConnectedNodes(nodeIndex)) {
+      if (aggregateIndices.at(neighborNodeIndex) == unassigned
+          && fixedNodeIndices.contains(neighborNodeIndex) == isFixedNode) {
+        aggregateIndices.at(neighborNodeIndex) = numberOfAggregates;
+      }
+    }
+    ++numberOfAggregates;
+  }
+  return numberOfAggregates;
+}
+
+// Map the polygon nodes to their aggregates and remove repeated aggregates of
+// consecutive nodes. Returns an empty vector if the resulting agglomerate is
+// not a polygon with pairwise different aggregates.
+std::vector<std::size_t> getAgglomerateNodeIndices(
+    const Mathematics::Polygon& polygon,
+    const std::vector<std::size_t>& aggregateIndices) {
+  std::vector<std::size_t> agglomerateNodeIndices;
+  for (const auto nodeIndex : polygon.getNodeIndices()) {
+    const auto aggregateIndex = aggregateIndices.at(nodeIndex);
+    if (agglomerateNodeIndices.empty()
+        || agglomerateNodeIndices.back() != aggregateIndex) {
+      agglomerateNodeIndices.push_back(aggregateIndex);
+    }
+  }
+  while (agglomerateNodeIndices.size() > 1
+         && agglomerateNodeIndices.front() == agglomerateNodeIndices.back()) {
+    agglomerateNodeIndices.pop_back();
+  }
+  auto sortedNodeIndices = agglomerateNodeIndices;
+  std::sort(sortedNodeIndices.begin(), sortedNodeIndices.end());
+  if (agglomerateNodeIndices.size() < 3
+      || std::adjacent_find(sortedNodeIndices.begin(), sortedNodeIndices.end())
+             != sortedNodeIndices.end()) {
+    return {};
+  }
+  return agglomerateNodeIndices;
+}
+}  // namespace
+
+namespace Mesh {
+CoarsenedMesh coarsenMesh(const PolygonalMesh& mesh) {
+  std::vector<std::size_t> aggregateIndices;
+  const auto numberOfAggregates = aggregateNodes(mesh, aggregateIndices);
+
+  std::vector<Mathematics::Polygon> coarsePolygons;
+  std::vector<bool> isContainedInPolygon(numberOfAggregates, false);
+  for (const auto& polygon : mesh.getPolygons()) {
+    const auto agglomerateNodeIndices =
+        getAgglomerateNodeIndices(polygon, aggregateIndices);
+    if (agglomerateNodeIndices.empty()) {
+      continue;
+    }
+    for (const auto aggregateIndex : agglomerateNodeIndices) {
+      isContainedInPolygon.at(aggregateIndex) = true;
+    }
+    coarsePolygons.emplace_back(agglomerateNodeIndices);
+  }
+
+  std::unordered_set<std::size_t> coarseFixedNodeIndices;
+  for (std::size_t aggregateIndex = 0; aggregateIndex < numberOfAggregates;
+       ++aggregateIndex) {
+    if (!isContainedInPolygon.at(aggregateIndex)) {
+      coarseFixedNodeIndices.insert(aggregateIndex);
+    }
+  }
+  for (const auto nodeIndex : mesh.getFixedNodeIndices()) {
+    coarseFixedNodeIndices.insert(aggregateIndices.at(nodeIndex));
+  }
+
+  CoarsenedMesh coarsenedMesh{
+      PolygonalMesh(std::vector<Mathematics::Vector2D>(
+                        numberOfAggregates, Mathematics::Vector2D(0.0, 0.0)),
+                    coarsePolygons, coarseFixedNodeIndices),
+      std::move(aggregateIndices)};
+  coarsenedMesh.mesh.setNodes(
+      restrictToCoarseMesh(mesh.getNodes(), coarsenedMesh));
+  return coarsenedMesh;
+}
+
+std::vector<Mathematics::Vector2D> restrictToCoarseMesh(
+    const std::vector<Mathematics::Vector2D>& finerNodeVectors,
+    const CoarsenedMesh& coarsenedMesh) {
+  const auto& aggregateIndices = coarsenedMesh.aggregateIndices;
+  Utility::throwExceptionIfFalse(
+      finerNodeVectors.size() == aggregateIndices.size(),
+      "Non matching number of nodes.");
+  const auto numberOfAggregates = coarsenedMesh.mesh.getNumberOfNodes();
+  std::vector<Mathematics::Vector2D> coarseNodeVectors(
+      numberOfAggregates, Mathematics::Vector2D(0.0, 0.0));
+  std::vector<std::size_t> aggregateSizes(numberOfAggregates, 0);
+  for (std::size_t nodeIndex = 0; nodeIndex < finerNodeVectors.size();
+       ++nodeIndex) {
+    const auto aggregateIndex = aggregateIndices.at(nodeIndex);
+    coarseNodeVectors.at(aggregateIndex) += finerNodeVectors.at(nodeIndex);
+    ++aggregateSizes.at(aggregateIndex);
+  }
+  for (std::size_t aggregateIndex = 0; aggregateIndex < numberOfAggregates;
+       ++aggregateIndex) {
+    coarseNodeVectors.at(aggregateIndex) /=
+        static_cast<double>(aggregateSizes.at(aggregateIndex));
+  }
+  return coarseNodeVectors;
+}
+
+std::vector<Mathematics::Vector2D> prolongateDisplacements(
+    const std::vector<Mathematics::Vector2D>& coarseDisplacements,
+    const CoarsenedMesh& coarsenedMesh,
+    const PolygonalMesh& finerMesh) {
+  const auto& aggregateIndices = coarsenedMesh.aggregateIndices;
+  Utility::throwExceptionIfFalse(
+      coarseDisplacements.size() == coarsenedMesh.mesh.getNumberOfNodes()
+          && finerMesh.getNumberOfNodes() == aggregateIndices.size(),
+      "Non matching number of nodes.");
+  std::vector<Mathematics::Vector2D> finerDisplacements(
+      finerMesh.getNumberOfNodes(), Mathematics::Vector2D(0.0, 0.0));
+  for (const auto nodeIndex : finerMesh.getNonFixedNodeIndices()) {
+    const auto& edgeConnectedNodeIndices =
+        finerMesh.getIndicesOfEdgeConnectedNodes(nodeIndex);
+    auto& displacement = finerDisplacements.at(nodeIndex);
+    displacement = coarseDisplacements.at(aggregateIndices.at(nodeIndex));
+    for (const auto neighborNodeIndex : edgeConnectedNodeIndices) {
+      displacement +=
+          coarseDisplacements.at(aggregateIndices.at(neighborNodeIndex));
+    }
+    displacement /= static_cast<double>(edgeConnectedNodeIndices.size() + 1);
+  }
+  return finerDisplacements;
+}
+}  // namespace Mesh
@@ -28,11 +28,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <tuple>
 
 namespace {
+template <typename Scalar>
 std::tuple<double, double> computeQMinAndQMeanTerminateIfInvalid(
-    const std::vector<double>& polygonMeanRatioQualityNumbers) {
+    const std::vector<Scalar>& polygonMeanRatioQualityNumbers) {
   double qMin = std::numeric_limits<double>::infinity();
   double sumOfMeanRatioNumbers = 0.0;
-  for (const auto meanRatioNumber : polygonMeanRatioQualityNumbers) {
+  for (const auto value : polygonMeanRatioQualityNumbers) {
+    const auto meanRatioNumber = static_cast<double>(value);
     if (meanRatioNumber <= 0.0) {
       return std::make_tuple(-1.0, -1.0);
     }
@@ -48,9 +50,10 @@ std::tuple<double, double> computeQMinAndQMeanTerminateIfInvalid(
 
 // Compute all quality numbers except q_min* if mesh is not given.
 // Do not terminate computation preliminary.
+template <typename Scalar>
 std::tuple<double, std::optional<double>, double, std::size_t>
 computeQMinQMinStarQMeanAndNumberOfInvalid(
-    const std::vector<double>& polygonMeanRatioQualityNumbers,
+    const std::vector<Scalar>& polygonMeanRatioQualityNumbers,
     const Mesh::PolygonalMesh* mesh = nullptr) {
   double qMin = std::numeric_limits<double>::infinity();
   double qMinStar = std::numeric_limits<double>::infinity();
@@ -59,8 +62,8 @@ computeQMinQMinStarQMeanAndNumberOfInvalid(
   std::size_t numberOfInvalid = 0;
   for (std::size_t polygonIndex = 0;
        polygonIndex < polygonMeanRatioQualityNumbers.size(); ++polygonIndex) {
-    const double meanRatioNumber =
-        polygonMeanRatioQualityNumbers.at(polygonIndex);
+    const auto meanRatioNumber =
+        static_cast<double>(polygonMeanRatioQualityNumbers.at(polygonIndex));
     if (meanRatioNumber <= 0.0) {
       ++numberOfInvalid;
     }
@@ -96,7 +99,8 @@ MeshQuality::MeshQuality(const PolygonalMesh& mesh) {
                                                  &mesh);
 }
 
-MeshQuality::MeshQuality(const std::vector<double>& elementMeanRatioNumbers,
+template <typename Scalar>
+MeshQuality::MeshQuality(const std::vector<Scalar>& elementMeanRatioNumbers,
                          const bool determineNumberOfInvalidElements) {
   if (determineNumberOfInvalidElements) {
     std::tie(qMin, qMinStar, qMean, numberOfInvalidElements) =
@@ -106,4 +110,11 @@ MeshQuality::MeshQuality(const std::vector<double>& elementMeanRatioNumbers,
         computeQMinAndQMeanTerminateIfInvalid(elementMeanRatioNumbers);
   }
 }
+
+template MeshQuality::MeshQuality(
+    const std::vector<double>& elementMeanRatioNumbers,
+    const bool determineNumberOfInvalidElements);
+template MeshQuality::MeshQuality(
+    const std::vector<float>& elementMeanRatioNumbers,
+    const bool determineNumberOfInvalidElements);
 }  // namespace Mesh
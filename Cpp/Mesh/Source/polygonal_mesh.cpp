@@ -23,10 +23,17 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/polygonal_mesh.h"
 
 #include "Utility/exception_handling.h"
+#include "Utility/tracing.h"
 
 #include <algorithm>
 
 namespace Mesh {
+Utility::MemoryUsage PolygonalMeshMemoryUsage::getTotal() const {
+  return nodes + polygons + fixedNodeIndices + nonFixedNodeIndices
+         + fixedPolygonFlags + edgeConnectedNodes + attachedPolygons
+         + neighborPolygons;
+}
+
 PolygonalMesh::PolygonalMesh(
     const std::vector<Mathematics::Vector2D>& nodes,
     const std::vector<Mathematics::Polygon>& polygons,
@@ -39,6 +46,7 @@ PolygonalMesh::PolygonalMesh(
   , attachedPolygonIndices(nodes.size(), std::unordered_set<std::size_t>())
   , indicesOfNeighborPolygons(polygons.size(),
                               std::unordered_set<std::size_t>()) {
+  const Utility::ScopedTraceSpan traceSpan("topology build");
   setNonFixedNodes();
   setFixedPolygonAndNodeTopologyData();
   setIndicesOfNeighborPolygons();
@@ -51,6 +59,23 @@ void PolygonalMesh::setNodes(
   nodes = newNodes;
 }
 
+PolygonalMeshMemoryUsage PolygonalMesh::getMemoryUsage() const {
+  Utility::MemoryUsage polygonsMemoryUsage{
+      polygons.capacity() * sizeof(Mathematics::Polygon), 0};
+  for (const auto& polygon : polygons) {
+    polygonsMemoryUsage += {polygon.getHeapCapacityInBytes(),
+                            polygon.getNumberOfNodes() * sizeof(std::size_t)};
+  }
+  return {Utility::getMemoryUsage(nodes),
+          polygonsMemoryUsage,
+          Utility::getMemoryUsage(fixedNodeIndices),
+          Utility::getMemoryUsage(nonFixedNodeIndices),
+          Utility::getMemoryUsage(areAllPolygonNodesFixed),
+          Utility::getMemoryUsage(indicesOfEdgeConnectedNodes),
+          Utility::getMemoryUsage(attachedPolygonIndices),
+          Utility::getMemoryUsage(indicesOfNeighborPolygons)};
+}
+
 void PolygonalMesh::setNonFixedNodes() {
   const std::size_t numberOfMeshNodes = nodes.size();
   Utility::throwExceptionIfFalse(
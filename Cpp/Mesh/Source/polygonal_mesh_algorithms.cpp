@@ -27,12 +27,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Utility/exception_handling.h"
+#include "Utility/tracing.h"
 
 #include <algorithm>
 #include <execution>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <random>
 
 namespace {
 const std::string PolygonalMeshKeyword = "planar_polygonal_mesh";
@@ -91,6 +93,7 @@ void writeMeanRatioQualityNumbers(const Mesh::PolygonalMesh& mesh,
 void Mesh::writeMeshFile(const PolygonalMesh& mesh,
                          const std::filesystem::path& outfilePath,
                          const bool includeMeanRatioQuality) {
+  const Utility::ScopedTraceSpan traceSpan("mesh file write");
   Utility::throwExceptionIfFalse(outfilePath.has_filename(),
                                  "No filename int outfile path given.");
   try {
@@ -144,11 +147,13 @@ std::vector<Mathematics::Polygon> readMeshPolygons(std::ifstream& infile) {
                                  "Polygons keyword expected but not found.");
   std::vector<Mathematics::Polygon> polygons;
   polygons.reserve(numberOfPolygons);
+  // Node indices buffer reused for all polygons.
+  std::vector<std::size_t> nodeIndices;
   for (std::size_t polygonIndex = 0; polygonIndex < numberOfPolygons;
        ++polygonIndex) {
     std::size_t numberOfNodeIndices;
     infile >> numberOfNodeIndices;
-    std::vector<std::size_t> nodeIndices;
+    nodeIndices.clear();
     nodeIndices.reserve(numberOfNodeIndices);
     for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodeIndices;
          ++nodeNumber) {
@@ -180,6 +185,7 @@ std::unordered_set<std::size_t> readFixedNodeIndices(std::ifstream& infile) {
 
 Mesh::PolygonalMesh Mesh::readMeshFile(
     const std::filesystem::path& infilePath) {
+  const Utility::ScopedTraceSpan traceSpan("mesh file read");
   Utility::throwExceptionIfFalse(
       std::filesystem::exists(infilePath),
       "Did not find input file " + infilePath.string() + ".");
@@ -195,10 +201,11 @@ Mesh::PolygonalMesh Mesh::readMeshFile(
   }
 }
 
+template <typename Scalar>
 void Mesh::computeMeanRatioQualityNumberOfPolygons(
     const std::vector<Mathematics::Polygon>& polygons,
-    const std::vector<Mathematics::Vector2D>& nodes,
-    std::vector<double>& meanRatioQualityNumbers) {
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    std::vector<Scalar>& meanRatioQualityNumbers) {
   Utility::throwExceptionIfFalse(
       polygons.size() == meanRatioQualityNumbers.size(),
       "Mean ratio quality numbers vector size has to match number of "
@@ -212,6 +219,15 @@ void Mesh::computeMeanRatioQualityNumberOfPolygons(
                  meanRatioQualityNumbers.begin(), computeMeanRatioOfPolygon);
 }
 
+template void Mesh::computeMeanRatioQualityNumberOfPolygons(
+    const std::vector<Mathematics::Polygon>& polygons,
+    const std::vector<Mathematics::Vector2D>& nodes,
+    std::vector<double>& meanRatioQualityNumbers);
+template void Mesh::computeMeanRatioQualityNumberOfPolygons(
+    const std::vector<Mathematics::Polygon>& polygons,
+    const std::vector<Mathematics::Vector2DFloat>& nodes,
+    std::vector<float>& meanRatioQualityNumbers);
+
 std::vector<double> Mesh::computeMeanRatioQualityNumberOfPolygons(
     const std::vector<Mathematics::Polygon>& polygons,
     const std::vector<Mathematics::Vector2D>& nodes) {
@@ -232,10 +248,26 @@ bool Mesh::areEqual(const PolygonalMesh& first,
 Mesh::PolygonalMesh Mesh::distortNodesLocally(
     const PolygonalMesh& mesh,
     const double maxDistortionRadius) {
+  std::random_device device;
+  const std::uint64_t seed =
+      (static_cast<std::uint64_t>(device()) << 32) | device();
+  return distortNodesLocally(mesh, maxDistortionRadius, seed);
+}
+
+Mesh::PolygonalMesh Mesh::distortNodesLocally(const PolygonalMesh& mesh,
+                                              const double maxDistortionRadius,
+                                              const std::uint64_t seed) {
+  // Check before parallel execution, which does not propagate exceptions.
+  Utility::throwExceptionIfFalse(maxDistortionRadius > 0.0,
+                                 "Radius has to be > 0.0.");
   auto newNodes = mesh.getNodes();
-  for (const std::size_t nodeIndex : mesh.getNonFixedNodeIndices()) {
-    newNodes.at(nodeIndex) += Mathematics::getRandomVector(maxDistortionRadius);
-  }
+  const auto& nonFixedNodeIndices = mesh.getNonFixedNodeIndices();
+  std::for_each(std::execution::par_unseq, nonFixedNodeIndices.begin(),
+                nonFixedNodeIndices.end(),
+                [&newNodes, maxDistortionRadius, seed](const auto nodeIndex) {
+                  newNodes[nodeIndex] += Mathematics::getRandomVector(
+                      maxDistortionRadius, seed, nodeIndex);
+                });
   return PolygonalMesh(newNodes, mesh.getPolygons(),
                        mesh.getFixedNodeIndices());
 }
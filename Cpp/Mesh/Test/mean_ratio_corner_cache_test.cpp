@@ -0,0 +1,154 @@
+/*
+Unit tests for the cache of polygon mean ratio corner summands.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mesh/mean_ratio_corner_cache.h"
+
+#include "Mathematics/polygon_algorithms.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Testdata/meshes.h"
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+namespace {
+void expectCachedMeanRatiosEqual(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2D>& nodes,
+    const Mesh::MeanRatioCornerCache& cache) {
+  const auto& polygons = mesh.getPolygons();
+  for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+       ++polygonIndex) {
+    EXPECT_EQ(Mathematics::getMeanRatio(polygons.at(polygonIndex), nodes),
+              cache.getMeanRatio(polygonIndex));
+  }
+}
+}  // namespace
+
+TEST(MeanRatioCornerCache, initialMeanRatios) {
+  for (const auto& mesh : {Testdata::getMixedSampleMesh(),
+                           Testdata::getInvalidMixedSampleMesh()}) {
+    const Mesh::MeanRatioCornerCache cache(mesh);
+    expectCachedMeanRatiosEqual(mesh, mesh.getNodes(), cache);
+  }
+}
+
+TEST(MeanRatioCornerCache, movedNodes) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  Mesh::MeanRatioCornerCache cache(mesh);
+  auto nodes = mesh.getNodes();
+  const std::size_t movedNodeIndex = mesh.getNonFixedNodeIndices().front();
+  nodes.at(movedNodeIndex) += Mathematics::Vector2D(0.3, -0.2);
+  const std::vector<std::size_t> movedNodeIndices{movedNodeIndex};
+  cache.setMovedNodes(movedNodeIndices);
+
+  // Staged results do not change the cached state until accepted.
+  for (const auto polygonIndex :
+       mesh.getAttachedPolygonIndices(movedNodeIndex)) {
+    EXPECT_EQ(Mathematics::getMeanRatio(mesh.getPolygons().at(polygonIndex),
+                                        nodes),
+              cache.computeMeanRatioForMovedNodes(polygonIndex, nodes));
+  }
+  expectCachedMeanRatiosEqual(mesh, mesh.getNodes(), cache);
+  for (const auto polygonIndex :
+       mesh.getAttachedPolygonIndices(movedNodeIndex)) {
+    cache.acceptStagedValues(polygonIndex);
+  }
+  expectCachedMeanRatiosEqual(mesh, nodes, cache);
+
+  // Update for moving the node back.
+  cache.updateForMovedNodes(mesh.getNodes());
+  expectCachedMeanRatiosEqual(mesh, mesh.getNodes(), cache);
+}
+
+TEST(MeanRatioCornerCache, movedNodesOfPolygonWithCornerSummands) {
+  // Regular decagon attached to a triangle.
+  const std::size_t numberOfPolygonNodes = 10;
+  auto nodes = Mathematics::getNodesOfRegularPolygon(numberOfPolygonNodes);
+  nodes.push_back(Mathematics::Vector2D(2.0, 0.0));
+  std::vector<std::size_t> decagonNodeIndices(numberOfPolygonNodes);
+  std::iota(decagonNodeIndices.begin(), decagonNodeIndices.end(), 0);
+  const Mesh::PolygonalMesh mesh(
+      nodes, {Mathematics::Polygon(decagonNodeIndices),
+              Mathematics::Polygon({0, 10, 1})});
+  Mesh::MeanRatioCornerCache cache(mesh);
+  EXPECT_TRUE(Mesh::MeanRatioCornerCache::isBeneficialFor(mesh));
+  expectCachedMeanRatiosEqual(mesh, nodes, cache);
+
+  nodes.at(1) += Mathematics::Vector2D(-0.1, 0.05);
+  nodes.at(6) += Mathematics::Vector2D(0.2, 0.1);
+  const std::vector<std::size_t> movedNodeIndices{1, 6};
+  cache.setMovedNodes(movedNodeIndices);
+  cache.updateForMovedNodes(nodes);
+  expectCachedMeanRatiosEqual(mesh, nodes, cache);
+
+  // Invalidate a corner of the decagon.
+  nodes.at(3) = Mathematics::Vector2D(0.0, 0.0);
+  const std::vector<std::size_t> invalidatingNodeIndices{3};
+  cache.setMovedNodes(invalidatingNodeIndices);
+  EXPECT_EQ(-1.0, cache.computeMeanRatioForMovedNodes(0, nodes));
+  cache.acceptStagedValues(0);
+  expectCachedMeanRatiosEqual(mesh, nodes, cache);
+}
+
+TEST(MeanRatioCornerCache, updateForMovedNodesKeepsValuesOfOtherPolygons) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  Mesh::MeanRatioCornerCache cache(mesh);
+  const auto& nonFixedNodeIndices = mesh.getNonFixedNodeIndices();
+  const std::size_t movedNodeIndex = nonFixedNodeIndices.front();
+  const std::size_t otherNodeIndex = nonFixedNodeIndices.back();
+  ASSERT_NE(movedNodeIndex, otherNodeIndex);
+  const auto& attachedPolygonIndices =
+      mesh.getAttachedPolygonIndices(movedNodeIndex);
+  const auto& otherAttachedPolygonIndices =
+      mesh.getAttachedPolygonIndices(otherNodeIndex);
+  auto nodes = mesh.getNodes();
+  nodes.at(movedNodeIndex) += Mathematics::Vector2D(0.1, 0.05);
+  // Change a node, which is not marked as moved. Polygons, which are not
+  // attached to the moved node, must keep their cached values.
+  nodes.at(otherNodeIndex) += Mathematics::Vector2D(-0.2, 0.1);
+  const std::vector<std::size_t> movedNodeIndices{movedNodeIndex};
+  cache.setMovedNodes(movedNodeIndices);
+
+  cache.updateForMovedNodes(nodes);
+
+  const auto& polygons = mesh.getPolygons();
+  std::size_t numberOfUnchangedPolygons = 0;
+  for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+       ++polygonIndex) {
+    const auto& polygon = polygons.at(polygonIndex);
+    if (attachedPolygonIndices.contains(polygonIndex)) {
+      if (!otherAttachedPolygonIndices.contains(polygonIndex)) {
+        EXPECT_EQ(Mathematics::getMeanRatio(polygon, nodes),
+                  cache.getMeanRatio(polygonIndex));
+      }
+      continue;
+    }
+    EXPECT_EQ(Mathematics::getMeanRatio(polygon, mesh.getNodes()),
+              cache.getMeanRatio(polygonIndex));
+    if (otherAttachedPolygonIndices.contains(polygonIndex)) {
+      EXPECT_NE(Mathematics::getMeanRatio(polygon, nodes),
+                cache.getMeanRatio(polygonIndex));
+    }
+    ++numberOfUnchangedPolygons;
+  }
+  EXPECT_LT(0, numberOfUnchangedPolygons);
+}
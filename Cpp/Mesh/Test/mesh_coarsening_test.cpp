@@ -0,0 +1,99 @@
+/*
+Unit tests for the coarsening of polygonal meshes by node aggregation.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Mesh/mesh_coarsening.h"
+
+#include "Mathematics/polygon.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Testdata/meshes.h"
+
+#include "gtest/gtest.h"
+
+#include <unordered_set>
+#include <vector>
+
+TEST(MeshCoarsening, coarsenMesh) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+
+  const auto coarsenedMesh = Mesh::coarsenMesh(mesh);
+
+  // Fixed nodes are aggregated in pairs or triples, the non fixed nodes 9 and
+  // 10 form one aggregate.
+  const std::vector<std::size_t> expectedAggregateIndices{0, 0, 1, 1, 2, 2,
+                                                          3, 3, 0, 4, 4};
+  EXPECT_EQ(expectedAggregateIndices, coarsenedMesh.aggregateIndices);
+  // Polygon agglomerates spanning less than three aggregates are removed.
+  const std::vector<Mathematics::Polygon> expectedPolygons{
+      Mathematics::Polygon{{0, 1, 2, 4}},
+      Mathematics::Polygon{{2, 3, 4}},
+      Mathematics::Polygon{{3, 0, 4}},
+  };
+  EXPECT_EQ(expectedPolygons, coarsenedMesh.mesh.getPolygons());
+  const std::unordered_set<std::size_t> expectedFixedNodeIndices{0, 1, 2, 3};
+  EXPECT_EQ(expectedFixedNodeIndices,
+            coarsenedMesh.mesh.getFixedNodeIndices());
+  const auto& coarseNodes = coarsenedMesh.mesh.getNodes();
+  ASSERT_EQ(5, coarseNodes.size());
+  EXPECT_DOUBLE_EQ(5.0 / 3.0, coarseNodes.at(0).getX());
+  EXPECT_DOUBLE_EQ(2.0 / 3.0, coarseNodes.at(0).getY());
+  EXPECT_EQ(Mathematics::Vector2D(4.5, 1.5), coarseNodes.at(4));
+}
+
+TEST(MeshCoarsening, restrictToCoarseMesh) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  const auto coarsenedMesh = Mesh::coarsenMesh(mesh);
+  auto nodes = mesh.getNodes();
+  nodes.at(9) = {7.0, 3.0};
+
+  const auto coarseNodes = Mesh::restrictToCoarseMesh(nodes, coarsenedMesh);
+
+  EXPECT_EQ(coarsenedMesh.mesh.getNodes().at(3), coarseNodes.at(3));
+  EXPECT_EQ(Mathematics::Vector2D(5.0, 2.0), coarseNodes.at(4));
+  nodes.pop_back();
+  EXPECT_ANY_THROW(Mesh::restrictToCoarseMesh(nodes, coarsenedMesh));
+}
+
+TEST(MeshCoarsening, prolongateDisplacements) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  const auto coarsenedMesh = Mesh::coarsenMesh(mesh);
+  std::vector<Mathematics::Vector2D> coarseDisplacements(
+      coarsenedMesh.mesh.getNumberOfNodes(), Mathematics::Vector2D(0.0, 0.0));
+  coarseDisplacements.at(4) = {1.0, -2.0};
+
+  const auto displacements =
+      Mesh::prolongateDisplacements(coarseDisplacements, coarsenedMesh, mesh);
+
+  ASSERT_EQ(mesh.getNumberOfNodes(), displacements.size());
+  for (const auto nodeIndex : mesh.getFixedNodeIndices()) {
+    EXPECT_EQ(Mathematics::Vector2D(0.0, 0.0), displacements.at(nodeIndex));
+  }
+  // Node 9 and its edge connected nodes 1, 4, 6 and 10 belong to the
+  // aggregates 4, 0, 2, 3 and 4, respectively.
+  EXPECT_DOUBLE_EQ(0.4, displacements.at(9).getX());
+  EXPECT_DOUBLE_EQ(-0.8, displacements.at(9).getY());
+  // Node 10 and its edge connected nodes 0, 1, 6, 8 and 9 belong to the
+  // aggregates 4, 0, 0, 3, 0 and 4, respectively.
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, displacements.at(10).getX());
+  EXPECT_DOUBLE_EQ(-2.0 / 3.0, displacements.at(10).getY());
+  coarseDisplacements.pop_back();
+  EXPECT_ANY_THROW(
+      Mesh::prolongateDisplacements(coarseDisplacements, coarsenedMesh, mesh));
+}
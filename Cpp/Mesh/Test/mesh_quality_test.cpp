@@ -81,6 +81,22 @@ TEST(MeshQuality, qualityConstructorValidMeshWithValidCount) {
   EXPECT_TRUE(meshQuality.isValidMesh());
 }
 
+TEST(MeshQuality, qualityConstructorSinglePrecision) {
+  const bool determineNumberOfInvalidElements = true;
+  const auto meanRatioNumbers = getSampleMeshElementMeanRatioNumbers();
+  const std::vector<float> singlePrecisionMeanRatioNumbers(
+      meanRatioNumbers.begin(), meanRatioNumbers.end());
+  const Mesh::MeshQuality meshQuality(singlePrecisionMeanRatioNumbers,
+                                      determineNumberOfInvalidElements);
+  const double singlePrecisionQualityTolerance = 1.0e-7;
+  EXPECT_NEAR(expectedSampleMeshQMin, meshQuality.getQMin(),
+              singlePrecisionQualityTolerance);
+  EXPECT_NEAR(expectedSampleMeshQMean, meshQuality.getQMean(),
+              singlePrecisionQualityTolerance);
+  EXPECT_EQ(0, meshQuality.getNumberOfInvalidElements().value());
+  EXPECT_TRUE(meshQuality.isValidMesh());
+}
+
 TEST(MeshQuality, meshConstructorInvalidMesh) {
   const auto mesh = Testdata::getInvalidMixedSampleMesh();
   const Mesh::MeshQuality meshQuality(mesh);
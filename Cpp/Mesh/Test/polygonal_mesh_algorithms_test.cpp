@@ -28,6 +28,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 
@@ -181,4 +182,30 @@ TEST(PolygonalMeshAlgorithms, distortNodesLocally_throwIfRadiusInvalid) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   EXPECT_ANY_THROW(Mesh::distortNodesLocally(initialMesh, -1.0));
   EXPECT_ANY_THROW(Mesh::distortNodesLocally(initialMesh, 0.0));
+  EXPECT_ANY_THROW(Mesh::distortNodesLocally(initialMesh, 0.0, 1));
+}
+
+TEST(PolygonalMeshAlgorithms, distortNodesLocally_seeded) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxDistortionRadius = 4.0;
+  const std::uint64_t seed = 2023;
+  const auto distortedMesh =
+      Mesh::distortNodesLocally(initialMesh, maxDistortionRadius, seed);
+
+  EXPECT_TRUE(Mesh::areEqual(
+      distortedMesh,
+      Mesh::distortNodesLocally(initialMesh, maxDistortionRadius, seed)));
+  EXPECT_FALSE(Mesh::areEqual(
+      distortedMesh,
+      Mesh::distortNodesLocally(initialMesh, maxDistortionRadius, seed + 1)));
+  const auto& fixedNodeIndices = initialMesh.getFixedNodeIndices();
+  for (std::size_t nodeIndex = 0; nodeIndex < initialMesh.getNumberOfNodes();
+       ++nodeIndex) {
+    const double expectedMaxDistance =
+        fixedNodeIndices.contains(nodeIndex) ? 0.0 : maxDistortionRadius;
+    const double distance = (initialMesh.getNodes().at(nodeIndex)
+                             - distortedMesh.getNodes().at(nodeIndex))
+                                .getLength();
+    EXPECT_LE(distance, expectedMaxDistance);
+  }
 }
@@ -29,7 +29,9 @@ TEST(PolygonalMesh, constructorThrowsIfNodeIndexOutOfBound) {
   const auto nodes = Testdata::getMixedSampleMeshNodes();
   auto polygons = Testdata::getMixedSampleMeshPolygons();
   // Manipulate first polygon to have an out of bound node index.
-  auto firstPolygonNodeIndices = polygons.front().getNodeIndices();
+  const auto nodeIndices = polygons.front().getNodeIndices();
+  std::vector<std::size_t> firstPolygonNodeIndices(nodeIndices.begin(),
+                                                   nodeIndices.end());
   firstPolygonNodeIndices.at(0) = nodes.size();
   polygons.front() = Mathematics::Polygon(firstPolygonNodeIndices);
 
@@ -162,3 +164,34 @@ TEST(PolygonalMesh, getIndicesOfNeighborPolygons) {
               mixedMesh.getIndicesOfNeighborPolygons(polygonIndex));
   }
 }
+
+TEST(PolygonalMesh, getMemoryUsage) {
+  const auto mixedMesh = Testdata::getMixedSampleMesh();
+  const auto memoryUsage = mixedMesh.getMemoryUsage();
+  EXPECT_EQ(mixedMesh.getNumberOfNodes() * sizeof(Mathematics::Vector2D),
+            memoryUsage.nodes.payloadBytes);
+  std::size_t numberOfPolygonNodes = 0;
+  for (const auto& polygon : mixedMesh.getPolygons()) {
+    numberOfPolygonNodes += polygon.getNumberOfNodes();
+  }
+  EXPECT_EQ(numberOfPolygonNodes * sizeof(std::size_t),
+            memoryUsage.polygons.payloadBytes);
+  EXPECT_EQ(mixedMesh.getFixedNodeIndices().size() * sizeof(std::size_t),
+            memoryUsage.fixedNodeIndices.payloadBytes);
+  // Sum of the neighbor polygon counts given in getIndicesOfNeighborPolygons.
+  EXPECT_EQ(34 * sizeof(std::size_t),
+            memoryUsage.neighborPolygons.payloadBytes);
+
+  const auto total = memoryUsage.getTotal();
+  EXPECT_EQ(memoryUsage.nodes.bytes + memoryUsage.polygons.bytes
+                + memoryUsage.fixedNodeIndices.bytes
+                + memoryUsage.nonFixedNodeIndices.bytes
+                + memoryUsage.fixedPolygonFlags.bytes
+                + memoryUsage.edgeConnectedNodes.bytes
+                + memoryUsage.attachedPolygons.bytes
+                + memoryUsage.neighborPolygons.bytes,
+            total.bytes);
+  // Hash set based topology data is dominated by overhead.
+  EXPECT_GT(memoryUsage.edgeConnectedNodes.getOverheadBytes(),
+            memoryUsage.edgeConnectedNodes.payloadBytes);
+}
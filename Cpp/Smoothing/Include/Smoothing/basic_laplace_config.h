@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Smoothing/default_configuration.h"
+#include "Smoothing/smoothing_observer.h"
 
 #include <cstddef>
 
@@ -39,5 +40,34 @@ struct BasicLaplaceConfig final {
 
   // Terminate if the number of iterations exceeds this limit.
   std::size_t maxIterations = DefaultConfiguration::maxIterations;
+
+  // Terminate if the smoothing wall clock time exceeds this limit. Then, the
+  // mesh of the last iteration is returned. Must not be negative. For zero,
+  // exactly one iteration is carried out.
+  double maxWallClockTimeInSeconds =
+      DefaultConfiguration::maxWallClockTimeInSeconds;
+
+  // Optional observer of the smoothing progress, which can cancel smoothing.
+  SmoothingObserver observer;
+
+  // Record the convergence history every given number of iterations. Disabled
+  // for zero. Since basic Laplace does not assess the mesh quality, it is
+  // computed for each recorded iteration.
+  std::size_t convergenceHistoryInterval = 0;
+
+  // Active set mode is enabled for values greater than zero. Then, nodes are
+  // frozen if they and their neighbors moved less than this fraction of the
+  // node relocation distance threshold in the last iteration. Frozen nodes are
+  // reactivated as soon as a neighbor moves farther. Must be in [0,1]. Pays
+  // off if large parts of the mesh converged, e.g. after local modifications.
+  // Once the active nodes converged, an iteration over all non fixed nodes
+  // checks the threshold for the whole mesh and smoothing continues if it is
+  // exceeded.
+  double activeSetRelocationDistanceFraction = 0.0;
+
+  // Momentum factor beta of accelerated smoothing. For beta > 0, the node
+  // update of the previous iteration scaled by beta is added to the new node
+  // positions (heavy ball acceleration). Must be in [0,1).
+  double momentumFactor = 0.0;
 };
 }  // namespace Smoothing
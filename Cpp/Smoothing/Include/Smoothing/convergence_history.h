@@ -0,0 +1,64 @@
+/*
+Per iteration convergence data recorded by the smoothing algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Smoothing {
+// Convergence data of the mesh obtained by one smoothing iteration. Quality
+// numbers are set to -1.0 for invalid meshes.
+struct ConvergenceRecord final {
+  std::size_t iteration;
+  double qMin;
+  // Not set for meshes consisting of fixed polygons only.
+  std::optional<double> qMinStar;
+  double qMean;
+  // Maximal distance of the node relocations of the iteration.
+  double maxNodeRelocationDistance;
+  // Number of node resets to their previous position due to invalid elements.
+  // Not set for algorithms not preserving mesh validity.
+  std::optional<std::size_t> numberOfInvalidElementNodeResets;
+  // Wall clock time elapsed since the start of smoothing.
+  double elapsedWallClockTimeInSeconds;
+};
+
+using ConvergenceHistory = std::vector<ConvergenceRecord>;
+
+// Concatenate the histories of two consecutive smoothing phases. Iterations
+// and elapsed times of the second phase are offset by the given values of the
+// first phase.
+inline ConvergenceHistory concatenateConvergenceHistories(
+    const ConvergenceHistory& firstPhaseHistory,
+    const ConvergenceHistory& secondPhaseHistory,
+    const std::size_t firstPhaseIterations,
+    const double firstPhaseWallClockTimeInSeconds) {
+  auto history = firstPhaseHistory;
+  for (auto record : secondPhaseHistory) {
+    record.iteration += firstPhaseIterations;
+    record.elapsedWallClockTimeInSeconds += firstPhaseWallClockTimeInSeconds;
+    history.push_back(record);
+  }
+  return history;
+}
+}  // namespace Smoothing
@@ -24,6 +24,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mathematics/generalized_polygon_transformation.h"
 
 #include <cstddef>
+#include <limits>
 #include <vector>
 
 namespace Smoothing::DefaultConfiguration {
@@ -31,6 +32,10 @@ namespace Smoothing::DefaultConfiguration {
 // within one smoothing step.
 constexpr const std::size_t maxIterations = 10'000;
 
+// Wall clock time limit of smoothing algorithms. No limit by default.
+constexpr const double maxWallClockTimeInSeconds =
+    std::numeric_limits<double>::infinity();
+
 // Quality based termination threshold for algorithms improving all elements
 // within one smoothing step. Terminate if the improvement of the arithmetic
 // mean of all element quality numbers of one iteration drops below the
@@ -48,6 +53,22 @@ enum class PolygonTransformationSet {
   GETMeBookExamples,
 };
 
+// Floating point precision used by simultaneous GETMe variants.
+enum class FloatingPointPrecision {
+  // All computations are carried out in double precision.
+  Double,
+
+  // Node movement and element quality computations are carried out in single
+  // precision. Halves the memory bandwidth of the smoothing loops but
+  // validity is only guaranteed with respect to single precision. Falls back
+  // to mixed precision if the initial mesh is invalid in single precision.
+  Single,
+
+  // Node movement is carried out in single precision whereas element quality
+  // and mesh validity are assessed in double precision.
+  Mixed,
+};
+
 // Get default regularizing polygon transformation set vector. Polygons with n
 // nodes will be transformed by the n-th entry transformation of this vector.
 std::vector<Mathematics::GeneralizedPolygonTransformation>
@@ -31,7 +31,10 @@ struct GetmeConfig;
 struct GetmeResult;
 struct GetmeSequentialConfig;
 struct GetmeSimultaneousConfig;
+struct MultilevelGetmeConfig;
+struct MultilevelGetmeResult;
 struct SmoothingResult;
+class SmoothingWorkspace;
 
 // Basic GETMe simultaneous smoothing according to Section 6.1.1
 // of the GETMe book.
@@ -39,14 +42,49 @@ SmoothingResult basicGetmeSimultaneous(
     Mesh::PolygonalMesh mesh,
     const BasicGetmeSimultaneousConfig& config);
 
+// Basic GETMe simultaneous smoothing using the scratch buffers of the given
+// workspace.
+SmoothingResult basicGetmeSimultaneous(
+    Mesh::PolygonalMesh mesh,
+    const BasicGetmeSimultaneousConfig& config,
+    SmoothingWorkspace& workspace);
+
 // GETMe simultaneous smoothing according to Section 6.1.2 of the GETMe book.
 SmoothingResult getmeSimultaneous(Mesh::PolygonalMesh mesh,
                                   const GetmeSimultaneousConfig& config);
 
+// GETMe simultaneous smoothing using the scratch buffers of the given
+// workspace.
+SmoothingResult getmeSimultaneous(Mesh::PolygonalMesh mesh,
+                                  const GetmeSimultaneousConfig& config,
+                                  SmoothingWorkspace& workspace);
+
 // GETMe sequential smoothing according to Section 6.1.3 of the GETMe book.
 SmoothingResult getmeSequential(const Mesh::PolygonalMesh& mesh,
                                 const GetmeSequentialConfig& config);
 
+// GETMe sequential smoothing using the helper data buffers of the given
+// workspace.
+SmoothingResult getmeSequential(const Mesh::PolygonalMesh& mesh,
+                                const GetmeSequentialConfig& config,
+                                SmoothingWorkspace& workspace);
+
 // GETMe sequential smoothing according to Section 6.2.1 of the GETMe book.
 GetmeResult getme(const Mesh::PolygonalMesh& mesh, const GetmeConfig& config);
+
+// GETMe smoothing using the given workspace for GETMe simultaneous and GETMe
+// sequential.
+GetmeResult getme(const Mesh::PolygonalMesh& mesh,
+                  const GetmeConfig& config,
+                  SmoothingWorkspace& workspace);
+
+// Multilevel GETMe smoothing. Builds a hierarchy of coarse meshes by node
+// aggregation. From the coarsest to the finest level, the mesh nodes are
+// restricted to the level, the level is smoothed by basic GETMe simultaneous
+// and the prolongated node displacements are applied to the mesh. Finishes by
+// GETMe smoothing. Intended for large scale distortions, which GETMe only
+// resolves slowly by local element transformations. Not faster than GETMe for
+// the meshes of the multilevel GETMe benchmark.
+MultilevelGetmeResult multilevelGetme(const Mesh::PolygonalMesh& mesh,
+                                      const MultilevelGetmeConfig& config);
 }  // namespace Smoothing
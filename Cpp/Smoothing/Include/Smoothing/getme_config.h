@@ -45,5 +45,30 @@ struct GetmeConfig final {
 
   GetmeSimultaneousConfig getmeSimultaneousConfig;
   GetmeSequentialConfig getmeSequentialConfig;
+
+  // Wall clock time limit of both phases. If finite, GETMe simultaneous is
+  // limited to the given fraction of this time and GETMe sequential to the
+  // remaining time. Limits of the phase configs are kept if they are smaller.
+  // Must not be negative.
+  double maxWallClockTimeInSeconds =
+      DefaultConfiguration::maxWallClockTimeInSeconds;
+
+  // Fraction of the wall clock time limit assigned to GETMe simultaneous. Must
+  // be in [0,1].
+  double getmeSimultaneousWallClockTimeFraction = 0.5;
+
+  // Quality targets of both phases. If set, these replace the targets of the
+  // phase configs and GETMe sequential is skipped if the result of GETMe
+  // simultaneous already reaches them.
+  QualityTargets qualityTargets;
+
+  // Optional observer of both phases. If attached, it replaces the observers of
+  // the phase configs. If GETMe simultaneous is cancelled, GETMe sequential is
+  // skipped.
+  SmoothingObserver observer;
+
+  // Convergence history interval of both phases. If positive, it replaces the
+  // intervals of the phase configs.
+  std::size_t convergenceHistoryInterval = 0;
 };
 }  // namespace Smoothing
@@ -22,8 +22,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Mesh/polygonal_mesh.h"
+#include "Smoothing/convergence_history.h"
 #include "Smoothing/smoothing_result.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
 
+#include <algorithm>
 #include <string>
 
 namespace Smoothing {
@@ -34,11 +38,35 @@ struct GetmeResult final : public SmoothingResultBase {
         "GETMe",
         getmeSequentialSmoothingResult.mesh,
         getmeSimultaneousSmoothingResult.smoothingWallClockTimeInSeconds
-            + getmeSequentialSmoothingResult.smoothingWallClockTimeInSeconds)
+            + getmeSequentialSmoothingResult.smoothingWallClockTimeInSeconds,
+        concatenateConvergenceHistories(
+            getmeSimultaneousSmoothingResult.convergenceHistory,
+            getmeSequentialSmoothingResult.convergenceHistory,
+            getmeSimultaneousSmoothingResult.iterations,
+            getmeSimultaneousSmoothingResult.smoothingWallClockTimeInSeconds),
+        combinePhaseTimes(getmeSimultaneousSmoothingResult,
+                          getmeSequentialSmoothingResult),
+        getmeSimultaneousSmoothingResult.eventCounts
+            + getmeSequentialSmoothingResult.eventCounts,
+        // Both parts share one workspace, whose capacity only grows.
+        std::max(getmeSimultaneousSmoothingResult.peakScratchMemoryInBytes,
+                 getmeSequentialSmoothingResult.peakScratchMemoryInBytes))
     , getmeSimultaneousIterations(getmeSimultaneousSmoothingResult.iterations)
     , getmeSequentialIterations(getmeSequentialSmoothingResult.iterations) {}
 
   const std::size_t getmeSimultaneousIterations;
   const std::size_t getmeSequentialIterations;
+
+private:
+  static Utility::PhaseTimes combinePhaseTimes(
+      const SmoothingResult& getmeSimultaneousSmoothingResult,
+      const SmoothingResult& getmeSequentialSmoothingResult) {
+    Utility::PhaseTimes phaseTimes;
+    phaseTimes.add(getmeSimultaneousSmoothingResult.phaseTimes,
+                   "GETMe simultaneous ");
+    phaseTimes.add(getmeSequentialSmoothingResult.phaseTimes,
+                   "GETMe sequential ");
+    return phaseTimes;
+  }
 };
 }  // namespace Smoothing
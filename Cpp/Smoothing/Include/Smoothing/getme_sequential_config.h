@@ -24,6 +24,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mathematics/generalized_polygon_transformation.h"
 #include "Smoothing/default_configuration.h"
+#include "Smoothing/quality_targets.h"
+#include "Smoothing/smoothing_observer.h"
 
 #include <vector>
 
@@ -48,6 +50,12 @@ struct GetmeSequentialConfig final {
   // usually much larger than that of GETMe simultaneous.
   std::size_t maxIterations = 1'000'000;
 
+  // Terminate if the smoothing wall clock time exceeds this limit. Then, the
+  // best mesh found so far is returned. Must not be negative. For zero,
+  // exactly one iteration is carried out.
+  double maxWallClockTimeInSeconds =
+      DefaultConfiguration::maxWallClockTimeInSeconds;
+
   // Evaluate mesh quality after the given number of smoothing iterations, which
   // define one smoothing cycle.
   std::size_t qualityEvaluationCycleLength = 100;
@@ -56,6 +64,22 @@ struct GetmeSequentialConfig final {
   // q_min* improvements.
   std::size_t maxNoImprovementCycles = 20;
 
+  // Terminate if the mesh reaches the given quality targets. Then, the current
+  // mesh is returned. If q_min* is the only target, it is checked after each
+  // iteration, since only the polygons changed by the iteration have to be
+  // considered. Targets for q_min or q_mean require a pass over all polygons.
+  // Hence, all targets are checked after each smoothing cycle only if q_min or
+  // q_mean targets are given.
+  QualityTargets qualityTargets;
+
+  // Optional observer of the smoothing progress, which can cancel smoothing.
+  SmoothingObserver observer;
+
+  // Record the convergence history every given number of iterations. Disabled
+  // for zero. Each record requires a pass over all polygons, hence intervals
+  // in the order of the quality evaluation cycle length are recommended.
+  std::size_t convergenceHistoryInterval = 0;
+
   // Polygon quality penalty values to be applied depending on polygon selection
   // and transformed nodes applications success.
   double penaltyInvalid = 1.0e-4;
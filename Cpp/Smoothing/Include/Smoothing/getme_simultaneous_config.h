@@ -24,6 +24,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mathematics/generalized_polygon_transformation.h"
 #include "Smoothing/default_configuration.h"
+#include "Smoothing/quality_targets.h"
+#include "Smoothing/smoothing_observer.h"
 
 #include <vector>
 
@@ -43,6 +45,18 @@ struct GetmeSimultaneousConfig final {
   double weightExponentEta = 0.0;
   double relaxationParameterRho = 1.0;
 
+  // Polygons with a weight below this threshold are not transformed, since
+  // their contribution to the new node positions is negligible. Instead, their
+  // nodes contribute their current positions. Only effective for eta > 0,
+  // where the weight of polygons with mean ratio close to one tends to zero.
+  // Must be in [0,1).
+  double saturationWeightThreshold = 0.0;
+
+  // Momentum factor beta of accelerated smoothing. For beta > 0, the node
+  // update of the previous iteration scaled by beta is added to the new node
+  // positions (heavy ball acceleration). Must be in [0,1).
+  double momentumFactor = 0.0;
+
   // Terminate if the improvement of the arithmetic mean of all element quality
   // numbers of one iteration drops below the given threshold.
   double qMeanImprovementThreshold =
@@ -51,6 +65,27 @@ struct GetmeSimultaneousConfig final {
   // Terminate if the number of iterations exceeds this limit.
   std::size_t maxIterations = DefaultConfiguration::maxIterations;
 
+  // Terminate if the smoothing wall clock time exceeds this limit. Then, the
+  // best mesh found so far is returned. Must not be negative. For zero,
+  // exactly one iteration is carried out.
+  double maxWallClockTimeInSeconds =
+      DefaultConfiguration::maxWallClockTimeInSeconds;
+
+  // Terminate as soon as the mesh reaches the given quality targets. Then, this
+  // mesh is returned instead of the best mesh found so far.
+  QualityTargets qualityTargets;
+
+  // Optional observer of the smoothing progress, which can cancel smoothing.
+  SmoothingObserver observer;
+
+  // Record the convergence history every given number of iterations. Disabled
+  // for zero.
+  std::size_t convergenceHistoryInterval = 0;
+
+  // Floating point precision of the smoothing loop.
+  DefaultConfiguration::FloatingPointPrecision floatingPointPrecision =
+      DefaultConfiguration::FloatingPointPrecision::Double;
+
   // Regularizing transformations to apply.
   std::vector<Mathematics::GeneralizedPolygonTransformation>
       polygonTransformations;
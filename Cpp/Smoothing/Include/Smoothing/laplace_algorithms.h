@@ -29,6 +29,7 @@ namespace Smoothing {
 struct BasicLaplaceConfig;
 struct SmartLaplaceConfig;
 struct SmoothingResult;
+class SmoothingWorkspace;
 
 // Classic Laplacian smoothing by iterative connected node averaging.
 // Node updates are computed simultaneously and set afterwards. Thus the order
@@ -37,6 +38,11 @@ struct SmoothingResult;
 SmoothingResult basicLaplace(Mesh::PolygonalMesh mesh,
                              const BasicLaplaceConfig& config);
 
+// Basic Laplace smoothing using the scratch buffers of the given workspace.
+SmoothingResult basicLaplace(Mesh::PolygonalMesh mesh,
+                             const BasicLaplaceConfig& config,
+                             SmoothingWorkspace& workspace);
+
 // Smart Laplacian smoothing updating nodes only if this increases
 // the arithmetic mean of the mean ratio quality numbers of attached elements.
 // Node updates are computed simultaneously and set afterwards. Thus the order
@@ -44,4 +50,9 @@ SmoothingResult basicLaplace(Mesh::PolygonalMesh mesh,
 // Cf. Section 4.2.1 of the GETMe book.
 SmoothingResult smartLaplace(Mesh::PolygonalMesh mesh,
                              const SmartLaplaceConfig& config);
+
+// Smart Laplace smoothing using the scratch buffers of the given workspace.
+SmoothingResult smartLaplace(Mesh::PolygonalMesh mesh,
+                             const SmartLaplaceConfig& config,
+                             SmoothingWorkspace& workspace);
 }  // namespace Smoothing
@@ -0,0 +1,56 @@
+/*
+Configuration of multilevel GETMe smoothing.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Smoothing/getme_config.h"
+
+#include <cstddef>
+
+namespace Smoothing {
+struct MultilevelGetmeConfig final {
+  // Constructor based on the GETMe config constructor.
+  explicit MultilevelGetmeConfig(const std::size_t maxNumberOfPolygonNodes)
+    : getmeConfig(maxNumberOfPolygonNodes) {}
+
+  // Constructor based on the given GETMe config.
+  explicit MultilevelGetmeConfig(const GetmeConfig& getmeConfig)
+    : getmeConfig(getmeConfig) {}
+
+  // Maximal number of coarse levels of the node aggregation hierarchy. Zero
+  // disables coarse level smoothing, i.e., only GETMe is applied.
+  std::size_t maxNumberOfCoarseLevels = 3;
+
+  // Coarsening stops before a level with fewer non fixed nodes would be
+  // created.
+  std::size_t minNumberOfCoarseNonFixedNodes = 64;
+
+  // Number of basic GETMe simultaneous iterations smoothing a coarse level.
+  std::size_t coarseLevelIterations = 20;
+
+  // Number of cycles, each correcting the mesh by all coarse levels from the
+  // coarsest to the finest.
+  std::size_t numberOfCycles = 3;
+
+  // Config of GETMe smoothing applied to the finest level.
+  GetmeConfig getmeConfig;
+};
+}  // namespace Smoothing
@@ -0,0 +1,75 @@
+/*
+Result of multilevel GETMe smoothing.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Smoothing/convergence_history.h"
+#include "Smoothing/getme_result.h"
+#include "Smoothing/smoothing_result_base.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
+
+#include <cstddef>
+
+namespace Smoothing {
+struct MultilevelGetmeResult final : public SmoothingResultBase {
+  explicit MultilevelGetmeResult(
+      const GetmeResult& getmeResult,
+      const std::size_t numberOfCoarseLevels,
+      const double coarseLevelsWallClockTimeInSeconds,
+      const Utility::PhaseTimes& coarseLevelsPhaseTimes = {},
+      const Utility::EventCounts& coarseLevelsEventCounts = {},
+      const std::size_t coarseLevelsScratchMemoryInBytes = 0)
+    : SmoothingResultBase("Multilevel GETMe",
+                          getmeResult.mesh,
+                          coarseLevelsWallClockTimeInSeconds
+                              + getmeResult.smoothingWallClockTimeInSeconds,
+                          concatenateConvergenceHistories(
+                              {}, getmeResult.convergenceHistory, 0,
+                              coarseLevelsWallClockTimeInSeconds),
+                          combinePhaseTimes(coarseLevelsPhaseTimes,
+                                            getmeResult),
+                          coarseLevelsEventCounts + getmeResult.eventCounts,
+                          // Coarse level data is kept while GETMe is applied.
+                          coarseLevelsScratchMemoryInBytes
+                              + getmeResult.peakScratchMemoryInBytes)
+    , numberOfCoarseLevels(numberOfCoarseLevels)
+    , coarseLevelsWallClockTimeInSeconds(coarseLevelsWallClockTimeInSeconds)
+    , getmeSimultaneousIterations(getmeResult.getmeSimultaneousIterations)
+    , getmeSequentialIterations(getmeResult.getmeSequentialIterations) {}
+
+  // Number of coarse levels smoothed before applying GETMe.
+  const std::size_t numberOfCoarseLevels;
+  // Time spent for building and smoothing the coarse levels.
+  const double coarseLevelsWallClockTimeInSeconds;
+  const std::size_t getmeSimultaneousIterations;
+  const std::size_t getmeSequentialIterations;
+
+private:
+  static Utility::PhaseTimes combinePhaseTimes(
+      const Utility::PhaseTimes& coarseLevelsPhaseTimes,
+      const GetmeResult& getmeResult) {
+    auto phaseTimes = coarseLevelsPhaseTimes;
+    phaseTimes.add(getmeResult.phaseTimes, "");
+    return phaseTimes;
+  }
+};
+}  // namespace Smoothing
@@ -0,0 +1,56 @@
+/*
+Mesh quality targets terminating smoothing once reached.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Mesh/mesh_quality.h"
+
+#include <optional>
+
+namespace Smoothing {
+// Optional targets for the mesh quality numbers according to Equation 2.7 of
+// the GETMe book. Targets are reached if all given targets are met. If no
+// target is given, targets are never reached.
+struct QualityTargets final {
+  std::optional<double> qMin;
+  std::optional<double> qMinStar;
+  std::optional<double> qMean;
+
+  bool isSet() const {
+    return qMin.has_value() || qMinStar.has_value() || qMean.has_value();
+  }
+
+  // Check the given quality numbers of a mesh. A q_min* target is only met if
+  // q_min* is given.
+  bool isReachedBy(const double qMinValue,
+                   const std::optional<double>& qMinStarValue,
+                   const double qMeanValue) const {
+    return isSet() && qMinValue > 0.0 && (!qMin || qMinValue >= *qMin)
+           && (!qMinStar || (qMinStarValue && *qMinStarValue >= *qMinStar))
+           && (!qMean || qMeanValue >= *qMean);
+  }
+
+  bool isReachedBy(const Mesh::MeshQuality& meshQuality) const {
+    return isReachedBy(meshQuality.getQMin(), meshQuality.getQMinStar(),
+                       meshQuality.getQMean());
+  }
+};
+}  // namespace Smoothing
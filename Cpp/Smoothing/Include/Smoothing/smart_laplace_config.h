@@ -23,6 +23,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Smoothing/default_configuration.h"
+#include "Smoothing/smoothing_observer.h"
 
 #include <cstddef>
 
@@ -35,5 +36,18 @@ struct SmartLaplaceConfig {
 
   // Terminate if the number of iterations exceeds this limit.
   std::size_t maxIterations = DefaultConfiguration::maxIterations;
+
+  // Terminate if the smoothing wall clock time exceeds this limit. Then, the
+  // best mesh found so far is returned. Must not be negative. For zero,
+  // exactly one iteration is carried out.
+  double maxWallClockTimeInSeconds =
+      DefaultConfiguration::maxWallClockTimeInSeconds;
+
+  // Optional observer of the smoothing progress, which can cancel smoothing.
+  SmoothingObserver observer;
+
+  // Record the convergence history every given number of iterations. Disabled
+  // for zero.
+  std::size_t convergenceHistoryInterval = 0;
 };
 }  // namespace Smoothing
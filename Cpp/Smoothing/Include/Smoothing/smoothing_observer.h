@@ -0,0 +1,53 @@
+/*
+Observer of the smoothing progress supporting cancellation.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Mesh/mesh_quality.h"
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace Smoothing {
+// Progress data passed to smoothing observers.
+struct SmoothingProgress final {
+  std::string_view algorithmName;
+  std::size_t iteration;
+  // Quality of the current mesh. q_min* is not determined.
+  Mesh::MeshQuality meshQuality;
+  double elapsedWallClockTimeInSeconds;
+};
+
+// Optional observer of smoothing algorithms. If attached, the callback is
+// invoked after every iterationInterval iterations. Smoothing is cancelled if
+// the callback returns false. Then, the result of the algorithm is determined
+// as for other termination criteria. The mesh quality passed to the callback
+// is only computed if an observer is attached.
+struct SmoothingObserver final {
+  std::function<bool(const SmoothingProgress&)> callback;
+
+  // Must be positive.
+  std::size_t iterationInterval = 1;
+
+  bool isAttached() const { return static_cast<bool>(callback); }
+};
+}  // namespace Smoothing
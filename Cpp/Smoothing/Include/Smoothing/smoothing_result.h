@@ -22,16 +22,30 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Smoothing/smoothing_result_base.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
 
+#include <cstddef>
 #include <string>
+#include <utility>
 
 namespace Smoothing {
 struct SmoothingResult final : public SmoothingResultBase {
   explicit SmoothingResult(const std::string& algorithmName,
                            const Mesh::PolygonalMesh& mesh,
                            const double smoothingWallClockTimeInSeconds,
-                           const std::size_t iterations)
-    : SmoothingResultBase(algorithmName, mesh, smoothingWallClockTimeInSeconds)
+                           const std::size_t iterations,
+                           ConvergenceHistory convergenceHistory = {},
+                           Utility::PhaseTimes phaseTimes = {},
+                           const Utility::EventCounts& eventCounts = {},
+                           const std::size_t peakScratchMemoryInBytes = 0)
+    : SmoothingResultBase(algorithmName,
+                          mesh,
+                          smoothingWallClockTimeInSeconds,
+                          std::move(convergenceHistory),
+                          std::move(phaseTimes),
+                          eventCounts,
+                          peakScratchMemoryInBytes)
     , iterations(iterations) {}
 
   const std::size_t iterations;
@@ -24,22 +24,47 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
+#include "Smoothing/convergence_history.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
 
+#include <cstddef>
 #include <string>
+#include <utility>
 
 namespace Smoothing {
 struct SmoothingResultBase {
   explicit SmoothingResultBase(const std::string& algorithmName,
                                const Mesh::PolygonalMesh& mesh,
-                               const double smoothingWallClockTimeInSeconds)
+                               const double smoothingWallClockTimeInSeconds,
+                               ConvergenceHistory convergenceHistory = {},
+                               Utility::PhaseTimes phaseTimes = {},
+                               const Utility::EventCounts& eventCounts = {},
+                               const std::size_t peakScratchMemoryInBytes = 0)
     : algorithmName(algorithmName)
     , mesh(mesh)
     , meshQuality(mesh)
-    , smoothingWallClockTimeInSeconds(smoothingWallClockTimeInSeconds) {}
+    , smoothingWallClockTimeInSeconds(smoothingWallClockTimeInSeconds)
+    , convergenceHistory(std::move(convergenceHistory))
+    , phaseTimes(std::move(phaseTimes))
+    , eventCounts(eventCounts)
+    , peakScratchMemoryInBytes(peakScratchMemoryInBytes) {}
 
   const std::string algorithmName;
   const Mesh::PolygonalMesh mesh;
   const Mesh::MeshQuality meshQuality;
   const double smoothingWallClockTimeInSeconds;
+  // Only recorded if requested by the algorithm config.
+  const ConvergenceHistory convergenceHistory;
+  // Wall clock times of the algorithm phases. Only measured if phase timers are
+  // enabled.
+  const Utility::PhaseTimes phaseTimes;
+  // Counts of the events occurring during smoothing. Only counted if event
+  // counters are enabled. Includes events of concurrent smoothing runs.
+  const Utility::EventCounts eventCounts;
+  // Peak heap memory of the scratch data used during smoothing, e.g. workspace
+  // buffers, best mesh node copies and the min heap. Excludes the mesh itself.
+  // Includes capacity retained from earlier runs using the same workspace.
+  const std::size_t peakScratchMemoryInBytes;
 };
 }  // namespace Smoothing
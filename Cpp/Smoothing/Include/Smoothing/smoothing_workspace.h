@@ -0,0 +1,142 @@
+/*
+Reusable scratch buffers of the smoothing algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "Mathematics/node_coordinate_arrays.h"
+#include "Mathematics/vector2d.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Smoothing {
+// Mesh sized scratch buffers for one floating point precision.
+template <typename Scalar>
+struct SmoothingBuffers final {
+  using Vector = Mathematics::BasicVector2D<Scalar>;
+
+  // Mesh nodes converted to this precision.
+  std::vector<Vector> nodes;
+  std::vector<Vector> newNodePositions;
+  std::vector<Vector> temporaryNodePositions;
+  std::vector<Vector> bestQMeanNodes;
+  std::vector<Vector> previousNodes;
+  std::vector<Vector> transformedNodeSums;
+  std::vector<Scalar> nodeWeightSums;
+  std::vector<Scalar> polygonMeanRatioValues;
+};
+
+// Scratch buffers of the iterative reset of nodes of invalid elements. Dense
+// flags mark nodes to reset and polygons to reassess, whose indices are
+// collected in the corresponding worklists. Further dense flags mark nodes
+// already reset by the current step, which are never marked again. Fixed
+// nodes are marked as reset, since they keep their positions anyway.
+struct InvalidElementResetBuffers final {
+  std::vector<std::uint8_t> isNodeToReset;
+  std::vector<std::uint8_t> isNodeReset;
+  std::vector<std::uint8_t> isAffectedPolygon;
+  std::vector<std::size_t> indicesOfNodesToReset;
+  std::vector<std::size_t> indicesOfAffectedPolygons;
+  // Nodes reset by the last invalid element reset in order of their resets.
+  std::vector<std::size_t> indicesOfResetNodes;
+};
+
+// Scratch buffers of active set smoothing. Index lists hold the active nodes of
+// the current and the next iteration. Dense flags mark nodes contained in the
+// next active set and polygons with active nodes.
+struct ActiveSetBuffers final {
+  std::vector<std::uint8_t> isNextActiveNode;
+  std::vector<std::uint8_t> isActivePolygon;
+  std::vector<std::size_t> activeNodeIndices;
+  std::vector<std::size_t> nextActiveNodeIndices;
+};
+
+// Helper data of GETMe sequential, i.e. the polygon quality min heap, the
+// affected neighbor polygons, flags and the mean ratio corner cache. Defined
+// with the GETMe sequential algorithm, since its members are internal types.
+struct GetmeSequentialBuffers;
+
+// Owns the mesh sized scratch buffers of the smoothing algorithms. Buffers keep
+// their capacity between smoothing calls. Hence, passing the same workspace to
+// repeated smoothing calls avoids mesh sized allocations after the first call.
+// A workspace must not be shared by concurrently running smoothing calls.
+class SmoothingWorkspace final {
+public:
+  SmoothingWorkspace();
+  ~SmoothingWorkspace();
+  SmoothingWorkspace(SmoothingWorkspace&&) noexcept;
+  SmoothingWorkspace& operator=(SmoothingWorkspace&&) noexcept;
+
+  // Constructor reserving double precision buffers for meshes with the given
+  // number of nodes and polygons.
+  SmoothingWorkspace(const std::size_t numberOfNodes,
+                     const std::size_t numberOfPolygons);
+
+  // Reserve double precision buffers for meshes with the given number of nodes
+  // and polygons.
+  void reserve(const std::size_t numberOfNodes,
+               const std::size_t numberOfPolygons);
+
+  template <typename Scalar>
+  SmoothingBuffers<Scalar>& getBuffers() {
+    if constexpr (std::is_same_v<Scalar, double>) {
+      return doublePrecisionBuffers;
+    } else {
+      static_assert(std::is_same_v<Scalar, float>,
+                    "Only float and double buffers are supported.");
+      return singlePrecisionBuffers;
+    }
+  }
+
+  InvalidElementResetBuffers& getInvalidElementResetBuffers() {
+    return invalidElementResetBuffers;
+  }
+
+  ActiveSetBuffers& getActiveSetBuffers() { return activeSetBuffers; }
+
+  // Structure of arrays node buffers used by Laplace smoothing.
+  Mathematics::NodeCoordinateArrays& getCurrentNodeArrays() {
+    return currentNodeArrays;
+  }
+
+  Mathematics::NodeCoordinateArrays& getNewNodeArrays() {
+    return newNodeArrays;
+  }
+
+  // Buffers of GETMe sequential, which are created on first use.
+  GetmeSequentialBuffers& getGetmeSequentialBuffers();
+
+  // Get the accumulated capacity of all buffers in bytes.
+  std::size_t getCapacityInBytes() const;
+
+private:
+  SmoothingBuffers<double> doublePrecisionBuffers;
+  SmoothingBuffers<float> singlePrecisionBuffers;
+  InvalidElementResetBuffers invalidElementResetBuffers;
+  ActiveSetBuffers activeSetBuffers;
+  Mathematics::NodeCoordinateArrays currentNodeArrays;
+  Mathematics::NodeCoordinateArrays newNodeArrays;
+  std::unique_ptr<GetmeSequentialBuffers> getmeSequentialBuffers;
+};
+}  // namespace Smoothing
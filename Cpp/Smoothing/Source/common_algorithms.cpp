@@ -25,23 +25,32 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
+#include "Utility/phase_timer.h"
+#include "Utility/tracing.h"
 
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
 
+template <typename Scalar>
 void Smoothing::applyEdgeLengthScaling(
     const Mathematics::Polygon& polygon,
-    const std::vector<Mathematics::Vector2D>& originalMeshNodes,
-    std::vector<Mathematics::Vector2D>& transformedElementNodes) {
-  Mathematics::Vector2D commonPolygonCentroid(0.0, 0.0);
-  double originalPolygonLength = 0.0;
-  double transformedPolygonLength = 0.0;
-  const auto& polygonNodeIndices = polygon.getNodeIndices();
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& originalMeshNodes,
+    std::vector<Mathematics::BasicVector2D<Scalar>>& transformedElementNodes) {
+  Mathematics::BasicVector2D<Scalar> commonPolygonCentroid(Scalar(0),
+                                                           Scalar(0));
+  Scalar originalPolygonLength = Scalar(0);
+  Scalar transformedPolygonLength = Scalar(0);
+  const auto polygonNodeIndices = polygon.getNodeIndices();
   std::size_t previousMeshNodeIndex = polygonNodeIndices.back();
   std::size_t previousNodeIndex = polygonNodeIndices.size() - 1;
   for (std::size_t nodeNumber = 0; nodeNumber < polygonNodeIndices.size();
        ++nodeNumber) {
-    const std::size_t meshNodeIndex = polygonNodeIndices.at(nodeNumber);
+    const std::size_t meshNodeIndex = polygon.getNodeIndex(nodeNumber);
     commonPolygonCentroid += originalMeshNodes.at(meshNodeIndex);
     originalPolygonLength += (originalMeshNodes.at(meshNodeIndex)
                               - originalMeshNodes.at(previousMeshNodeIndex))
@@ -53,9 +62,9 @@ void Smoothing::applyEdgeLengthScaling(
             .getLength();
     previousNodeIndex = nodeNumber;
   }
-  commonPolygonCentroid /= static_cast<double>(polygonNodeIndices.size());
-  const double scalingFactor = originalPolygonLength / transformedPolygonLength;
-  const double oneMinusScalingFactor = 1.0 - scalingFactor;
+  commonPolygonCentroid /= static_cast<Scalar>(polygonNodeIndices.size());
+  const Scalar scalingFactor = originalPolygonLength / transformedPolygonLength;
+  const Scalar oneMinusScalingFactor = Scalar(1) - scalingFactor;
   for (std::size_t nodeNumber = 0; nodeNumber < polygonNodeIndices.size();
        ++nodeNumber) {
     transformedElementNodes.at(nodeNumber) =
@@ -64,69 +73,365 @@ void Smoothing::applyEdgeLengthScaling(
   }
 }
 
+template void Smoothing::applyEdgeLengthScaling(
+    const Mathematics::Polygon& polygon,
+    const std::vector<Mathematics::Vector2D>& originalMeshNodes,
+    std::vector<Mathematics::Vector2D>& transformedElementNodes);
+template void Smoothing::applyEdgeLengthScaling(
+    const Mathematics::Polygon& polygon,
+    const std::vector<Mathematics::Vector2DFloat>& originalMeshNodes,
+    std::vector<Mathematics::Vector2DFloat>& transformedElementNodes);
+
+template <typename Scalar>
+Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const std::vector<Scalar>& polygonMeanRatioValues) {
+  return Mesh::MeshQuality(polygonMeanRatioValues, false);
+}
+
+template Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const std::vector<double>& polygonMeanRatioValues);
+template Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const std::vector<float>& polygonMeanRatioValues);
+
+template <typename Scalar>
+Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes) {
+  std::vector<Scalar> polygonMeanRatioValues(mesh.getNumberOfPolygons());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(mesh.getPolygons(), nodes,
+                                                polygonMeanRatioValues);
+  return computeMeshQuality(polygonMeanRatioValues);
+}
+
+template Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2D>& nodes);
+template Mesh::MeshQuality Smoothing::computeMeshQuality(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2DFloat>& nodes);
+
+template <typename Scalar>
+std::optional<double> Smoothing::computeQMinStar(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues) {
+  double qMinStar = std::numeric_limits<double>::infinity();
+  for (std::size_t polygonIndex = 0;
+       polygonIndex < polygonMeanRatioValues.size(); ++polygonIndex) {
+    if (!mesh.isFixedPolygon(polygonIndex)) {
+      qMinStar = std::min(
+          qMinStar,
+          static_cast<double>(polygonMeanRatioValues.at(polygonIndex)));
+    }
+  }
+  if (qMinStar > 1.0) {
+    return std::nullopt;
+  }
+  return qMinStar;
+}
+
+template std::optional<double> Smoothing::computeQMinStar(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<double>& polygonMeanRatioValues);
+template std::optional<double> Smoothing::computeQMinStar(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<float>& polygonMeanRatioValues);
+
+template <typename Scalar>
+bool Smoothing::areQualityTargetsReached(
+    const QualityTargets& qualityTargets,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality) {
+  std::optional<double> qMinStar;
+  if (qualityTargets.qMinStar) {
+    qMinStar = computeQMinStar(mesh, polygonMeanRatioValues);
+  }
+  return qualityTargets.isReachedBy(meshQuality.getQMin(), qMinStar,
+                                    meshQuality.getQMean());
+}
+
+template bool Smoothing::areQualityTargetsReached(
+    const QualityTargets& qualityTargets,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<double>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality);
+template bool Smoothing::areQualityTargetsReached(
+    const QualityTargets& qualityTargets,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<float>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality);
+
+template <typename Scalar>
+double Smoothing::computeMaxNodeRelocationDistance(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& newNodePositions,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& oldNodePositions) {
+  double maxSquaredNodeRelocationDistance = 0.0;
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    maxSquaredNodeRelocationDistance =
+        std::max(maxSquaredNodeRelocationDistance,
+                 static_cast<double>((newNodePositions.at(nodeIndex)
+                                      - oldNodePositions.at(nodeIndex))
+                                         .getLengthSquared()));
+  }
+  return std::sqrt(maxSquaredNodeRelocationDistance);
+}
+
+template double Smoothing::computeMaxNodeRelocationDistance(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2D>& newNodePositions,
+    const std::vector<Mathematics::Vector2D>& oldNodePositions);
+template double Smoothing::computeMaxNodeRelocationDistance(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2DFloat>& newNodePositions,
+    const std::vector<Mathematics::Vector2DFloat>& oldNodePositions);
+
+template <typename Scalar>
+Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality,
+    const double maxNodeRelocationDistance,
+    const std::optional<std::size_t>& numberOfInvalidElementNodeResets,
+    const Utility::StopWatch& stopWatch) {
+  return ConvergenceRecord{iteration,
+                           meshQuality.getQMin(),
+                           meshQuality.isValidMesh()
+                               ? computeQMinStar(mesh, polygonMeanRatioValues)
+                               : std::nullopt,
+                           meshQuality.getQMean(),
+                           maxNodeRelocationDistance,
+                           numberOfInvalidElementNodeResets,
+                           stopWatch.getElapsedTimeInSeconds()};
+}
+
+template Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<double>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality,
+    const double maxNodeRelocationDistance,
+    const std::optional<std::size_t>& numberOfInvalidElementNodeResets,
+    const Utility::StopWatch& stopWatch);
+template Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<float>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality,
+    const double maxNodeRelocationDistance,
+    const std::optional<std::size_t>& numberOfInvalidElementNodeResets,
+    const Utility::StopWatch& stopWatch);
+
+template <typename Scalar>
+Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    const double maxNodeRelocationDistance,
+    const Utility::StopWatch& stopWatch) {
+  std::vector<Scalar> polygonMeanRatioValues(mesh.getNumberOfPolygons());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(mesh.getPolygons(), nodes,
+                                                polygonMeanRatioValues);
+  return createConvergenceRecord(
+      iteration, mesh, polygonMeanRatioValues,
+      computeMeshQuality(polygonMeanRatioValues), maxNodeRelocationDistance,
+      std::nullopt, stopWatch);
+}
+
+template Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2D>& nodes,
+    const double maxNodeRelocationDistance,
+    const Utility::StopWatch& stopWatch);
+template Smoothing::ConvergenceRecord Smoothing::createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2DFloat>& nodes,
+    const double maxNodeRelocationDistance,
+    const Utility::StopWatch& stopWatch);
+
 // Helper functions for upcoming implementation of algorithm
-// iterativelyResetNodesResultingInInvalidElementsSetNewMeshNodesAndUpdateElementQualityNumbers.
+// iterativelyResetNodesResultingInInvalidElements.
 namespace {
-// Collect all nodes to be reset to original position stored in mesh.
-std::unordered_set<std::size_t> getIndicesOfNodesToReset(
-    const std::vector<double>& polygonMeanRatioValues,
-    const Mesh::PolygonalMesh& mesh) {
-  std::unordered_set<std::size_t> indicesOfNodesToReset;
-  for (std::size_t polygonIndex = 0; polygonIndex < mesh.getNumberOfPolygons();
-       ++polygonIndex) {
-    if (polygonMeanRatioValues.at(polygonIndex) <= 0.0) {
-      const auto& polygonNodeIndices =
-          mesh.getPolygons().at(polygonIndex).getNodeIndices();
-      indicesOfNodesToReset.insert(polygonNodeIndices.begin(),
-                                   polygonNodeIndices.end());
+// Add the nodes of the given polygon to the worklist of nodes to reset. Fixed
+// nodes and nodes already reset are skipped.
+void markNodesOfPolygonToReset(const Mathematics::Polygon& polygon,
+                               Smoothing::InvalidElementResetBuffers& buffers) {
+  for (const auto nodeIndex : polygon.getNodeIndices()) {
+    if (!buffers.isNodeToReset[nodeIndex] && !buffers.isNodeReset[nodeIndex]) {
+      buffers.isNodeToReset[nodeIndex] = 1;
+      buffers.indicesOfNodesToReset.push_back(nodeIndex);
     }
   }
-  return indicesOfNodesToReset;
 }
 
-// Reset nodes and collect indices of all affected polygons.
-std::unordered_set<std::size_t> resetNodesAndGetAffectedPolygonIndices(
-    const std::unordered_set<std::size_t>& indicesOfNodesToReset,
+// Reset marked nodes to their old positions and collect the indices of all
+// affected polygons. Clears the worklist of nodes to reset.
+template <typename Scalar>
+void resetNodesAndCollectAffectedPolygons(
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& oldNodePositions,
     const Mesh::PolygonalMesh& mesh,
-    std::vector<Mathematics::Vector2D>& newNodePositions) {
-  std::unordered_set<std::size_t> indicesOfAffectedPolygons;
-  for (const auto nodeIndex : indicesOfNodesToReset) {
-    newNodePositions.at(nodeIndex) = mesh.getNodes().at(nodeIndex);
+    std::vector<Mathematics::BasicVector2D<Scalar>>& newNodePositions,
+    Smoothing::InvalidElementResetBuffers& buffers) {
+  buffers.indicesOfAffectedPolygons.clear();
+  for (const auto nodeIndex : buffers.indicesOfNodesToReset) {
+    buffers.isNodeToReset[nodeIndex] = 0;
+    buffers.isNodeReset[nodeIndex] = 1;
+    newNodePositions.at(nodeIndex) = oldNodePositions.at(nodeIndex);
+    buffers.indicesOfResetNodes.push_back(nodeIndex);
     for (const auto attachedPolygonIndex :
          mesh.getAttachedPolygonIndices(nodeIndex)) {
-      indicesOfAffectedPolygons.insert(attachedPolygonIndex);
+      if (!buffers.isAffectedPolygon[attachedPolygonIndex]) {
+        buffers.isAffectedPolygon[attachedPolygonIndex] = 1;
+        buffers.indicesOfAffectedPolygons.push_back(attachedPolygonIndex);
+      }
     }
   }
-  return indicesOfAffectedPolygons;
+  buffers.indicesOfNodesToReset.clear();
 }
 }  // namespace
 
+template <typename Scalar>
+Mesh::MeshQuality Smoothing::iterativelyResetNodesResultingInInvalidElements(
+    std::vector<Mathematics::BasicVector2D<Scalar>>& newNodePositions,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& oldNodePositions,
+    std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::PolygonalMesh& mesh,
+    InvalidElementResetBuffers& buffers,
+    Utility::PhaseTimes& phaseTimes) {
+  const auto& polygons = mesh.getPolygons();
+  {
+    const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                               "quality evaluation");
+    Mesh::computeMeanRatioQualityNumberOfPolygons(polygons, newNodePositions,
+                                                  polygonMeanRatioValues);
+  }
+  const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                             "invalid element reset");
+  buffers.isNodeToReset.assign(mesh.getNumberOfNodes(), 0);
+  buffers.isNodeReset.assign(mesh.getNumberOfNodes(), 0);
+  for (const auto fixedNodeIndex : mesh.getFixedNodeIndices()) {
+    buffers.isNodeReset[fixedNodeIndex] = 1;
+  }
+  buffers.isAffectedPolygon.assign(polygons.size(), 0);
+  buffers.indicesOfNodesToReset.clear();
+  buffers.indicesOfResetNodes.clear();
+  // Initial pass over all polygons.
+  for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+       ++polygonIndex) {
+    if (polygonMeanRatioValues.at(polygonIndex) <= Scalar(0)) {
+      markNodesOfPolygonToReset(polygons.at(polygonIndex), buffers);
+    }
+  }
+  // Since the previous step mesh was valid, termination is guaranteed, since
+  // worst case is reseting all elements. Only polygons with reset nodes can
+  // change their validity. Hence, only these have to be reassessed.
+  for (std::size_t round = 1; !buffers.indicesOfNodesToReset.empty();
+       ++round) {
+    const Utility::ScopedTraceSpan traceSpan("invalid element reset round",
+                                             round);
+    resetNodesAndCollectAffectedPolygons(oldNodePositions, mesh,
+                                         newNodePositions, buffers);
+    for (const auto polygonIndex : buffers.indicesOfAffectedPolygons) {
+      buffers.isAffectedPolygon[polygonIndex] = 0;
+      const auto& polygon = polygons.at(polygonIndex);
+      polygonMeanRatioValues.at(polygonIndex) =
+          Mathematics::getMeanRatio(polygon, newNodePositions);
+      if (polygonMeanRatioValues.at(polygonIndex) <= Scalar(0)) {
+        markNodesOfPolygonToReset(polygon, buffers);
+      }
+    }
+  }
+  Utility::countEvent(Utility::Event::NodeReset,
+                      buffers.indicesOfResetNodes.size());
+  return computeMeshQuality(polygonMeanRatioValues);
+}
+
+template Mesh::MeshQuality Smoothing::iterativelyResetNodesResultingInInvalidElements(
+    std::vector<Mathematics::Vector2D>& newNodePositions,
+    const std::vector<Mathematics::Vector2D>& oldNodePositions,
+    std::vector<double>& polygonMeanRatioValues,
+    const Mesh::PolygonalMesh& mesh,
+    InvalidElementResetBuffers& buffers,
+    Utility::PhaseTimes& phaseTimes);
+template Mesh::MeshQuality Smoothing::iterativelyResetNodesResultingInInvalidElements(
+    std::vector<Mathematics::Vector2DFloat>& newNodePositions,
+    const std::vector<Mathematics::Vector2DFloat>& oldNodePositions,
+    std::vector<float>& polygonMeanRatioValues,
+    const Mesh::PolygonalMesh& mesh,
+    InvalidElementResetBuffers& buffers,
+    Utility::PhaseTimes& phaseTimes);
+
 Mesh::MeshQuality Smoothing::
     iterativelyResetNodesResultingInInvalidElementsSetNewMeshNodesAndUpdateElementQualityNumbers(
         std::vector<Mathematics::Vector2D>& newNodePositions,
         std::vector<double>& polygonMeanRatioValues,
         Mesh::PolygonalMesh& mesh) {
-  Mesh::computeMeanRatioQualityNumberOfPolygons(
-      mesh.getPolygons(), newNodePositions, polygonMeanRatioValues);
-  while (true) {
-    const auto indicesOfNodesToReset =
-        getIndicesOfNodesToReset(polygonMeanRatioValues, mesh);
-    // Since the previous step mesh was valid, termination is guaranteed, since
-    // worst case is reseting all elements.
-    if (indicesOfNodesToReset.empty()) {
-      break;
-    }
-    const auto indicesOfAffectedPolygons =
-        resetNodesAndGetAffectedPolygonIndices(indicesOfNodesToReset, mesh,
-                                               newNodePositions);
-    // Recompute mean ratio numbers of affected polygons.
-    for (const auto polygonIndex : indicesOfAffectedPolygons) {
-      polygonMeanRatioValues.at(polygonIndex) = Mathematics::getMeanRatio(
-          mesh.getPolygons().at(polygonIndex), newNodePositions);
-    }
-  }
+  InvalidElementResetBuffers buffers;
+  Utility::PhaseTimes phaseTimes;
+  const auto meshQuality = iterativelyResetNodesResultingInInvalidElements(
+      newNodePositions, mesh.getNodes(), polygonMeanRatioValues, mesh,
+      buffers, phaseTimes);
   mesh.setNodes(newNodePositions);
-  return Mesh::MeshQuality(polygonMeanRatioValues, false);
+  return meshQuality;
+}
+
+void Smoothing::initializeActiveSet(const Mesh::PolygonalMesh& mesh,
+                                    ActiveSetBuffers& buffers) {
+  buffers.isNextActiveNode.assign(mesh.getNumberOfNodes(), 0);
+  for (const auto fixedNodeIndex : mesh.getFixedNodeIndices()) {
+    buffers.isNextActiveNode.at(fixedNodeIndex) = 1;
+  }
+  buffers.isActivePolygon.assign(mesh.getNumberOfPolygons(), 0);
+  buffers.activeNodeIndices = mesh.getNonFixedNodeIndices();
+  buffers.nextActiveNodeIndices.clear();
+}
+
+void Smoothing::advanceActiveSet(ActiveSetBuffers& buffers) {
+  for (const auto nodeIndex : buffers.nextActiveNodeIndices) {
+    buffers.isNextActiveNode[nodeIndex] = 0;
+  }
+  std::swap(buffers.activeNodeIndices, buffers.nextActiveNodeIndices);
+  buffers.nextActiveNodeIndices.clear();
+}
+
+void Smoothing::activateAllNonFixedNodesInNextIteration(
+    const Mesh::PolygonalMesh& mesh,
+    ActiveSetBuffers& buffers) {
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    activateNodeInNextIteration(nodeIndex, buffers);
+  }
+}
+
+bool Smoothing::containsAllNonFixedNodes(const Mesh::PolygonalMesh& mesh,
+                                         const ActiveSetBuffers& buffers) {
+  return buffers.activeNodeIndices.size()
+         == mesh.getNonFixedNodeIndices().size();
+}
+
+void Smoothing::checkActiveSetRelocationDistanceFraction(
+    const double fraction) {
+  Utility::throwExceptionIfFalse(
+      fraction >= 0.0 && fraction <= 1.0,
+      "Active set relocation distance fraction must be in [0,1].");
+}
+
+void Smoothing::checkMomentumFactor(const double momentumFactor) {
+  Utility::throwExceptionIfFalse(momentumFactor >= 0.0 && momentumFactor < 1.0,
+                                 "Momentum factor must be in [0,1).");
+}
+
+void Smoothing::checkMaxWallClockTime(const double maxWallClockTimeInSeconds) {
+  Utility::throwExceptionIfFalse(maxWallClockTimeInSeconds >= 0.0,
+                                 "Wall clock time limit must not be negative.");
+}
+
+void Smoothing::checkObserver(const SmoothingObserver& observer) {
+  Utility::throwExceptionIfFalse(
+      observer.iterationInterval > 0,
+      "Observer iteration interval must be positive.");
 }
 
 void Smoothing::checkTransformations(
@@ -25,7 +25,18 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mathematics/polygon.h"
 #include "Mathematics/polygon_algorithms.h"
 #include "Mathematics/vector2d.h"
+#include "Smoothing/convergence_history.h"
+#include "Smoothing/quality_targets.h"
+#include "Smoothing/smoothing_observer.h"
+#include "Smoothing/smoothing_workspace.h"
+#include "Utility/phase_timer.h"
+#include "Utility/stop_watch.h"
 
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace Mesh {
@@ -38,19 +49,22 @@ namespace Smoothing {
 // GETMe book. Both, the original nodes p_k as well as the transformed nodes
 // p''_k have to be provided. The nodes p''_k will be adjusted to their edge
 // scaled variants. Here it is used, that the original as well as the
-// transformed polygon share the same centroid.
+// transformed polygon share the same centroid. Instantiated for float and
+// double.
+template <typename Scalar>
 void applyEdgeLengthScaling(
     const Mathematics::Polygon& polygon,
-    const std::vector<Mathematics::Vector2D>& originalMeshNodes,
-    std::vector<Mathematics::Vector2D>& transformedElementNodes);
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& originalMeshNodes,
+    std::vector<Mathematics::BasicVector2D<Scalar>>& transformedElementNodes);
 
 // Compute the squared distance d between a node and its new position and
 // update the maximal squared distance dmax if dmax < d.
+template <typename Scalar>
 inline void updateMaxSquaredNodeRelocationDistance(
-    const Mathematics::Vector2D& oldNodePosition,
-    const Mathematics::Vector2D& newNodePosition,
-    double& maxSquaredNodeRelocationDistance) {
-  if (const double squaredNodeRelocationDistance =
+    const Mathematics::BasicVector2D<Scalar>& oldNodePosition,
+    const Mathematics::BasicVector2D<Scalar>& newNodePosition,
+    Scalar& maxSquaredNodeRelocationDistance) {
+  if (const Scalar squaredNodeRelocationDistance =
           (newNodePosition - oldNodePosition).getLengthSquared();
       squaredNodeRelocationDistance > maxSquaredNodeRelocationDistance) {
     maxSquaredNodeRelocationDistance = squaredNodeRelocationDistance;
@@ -58,10 +72,11 @@ inline void updateMaxSquaredNodeRelocationDistance(
 }
 
 // Transform a polygon and apply edge length scaling.
-inline std::vector<Mathematics::Vector2D> transformAndScaleElement(
+template <typename Scalar>
+inline std::vector<Mathematics::BasicVector2D<Scalar>> transformAndScaleElement(
     const Mathematics::GeneralizedPolygonTransformation& transformation,
     const Mathematics::Polygon& polygon,
-    const std::vector<Mathematics::Vector2D>& meshNodes) {
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& meshNodes) {
   auto transformedElementNodes =
       transformation.getNodesOfTransformedPolygon(polygon, meshNodes);
   applyEdgeLengthScaling(polygon, meshNodes, transformedElementNodes);
@@ -70,25 +85,92 @@ inline std::vector<Mathematics::Vector2D> transformAndScaleElement(
 
 // Transform a polygon, apply edge length scaling and relaxation
 // according to Definition 5.6 of the GETMe book.
-inline std::vector<Mathematics::Vector2D> transformScaleAndRelaxElement(
+template <typename Scalar>
+inline std::vector<Mathematics::BasicVector2D<Scalar>>
+transformScaleAndRelaxElement(
     const Mathematics::GeneralizedPolygonTransformation& transformation,
     const double relaxationFactorRho,
     const Mathematics::Polygon& polygon,
-    const std::vector<Mathematics::Vector2D>& meshNodes) {
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& meshNodes) {
   auto newElementNodes =
       transformAndScaleElement(transformation, polygon, meshNodes);
   if (relaxationFactorRho != 1.0) {
-    const double oneMinusRho = 1.0 - relaxationFactorRho;
+    const auto rho = static_cast<Scalar>(relaxationFactorRho);
+    const Scalar oneMinusRho = Scalar(1) - rho;
     for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
          ++nodeNumber) {
       newElementNodes.at(nodeNumber) =
           oneMinusRho * meshNodes.at(polygon.getNodeIndex(nodeNumber))
-          + relaxationFactorRho * newElementNodes.at(nodeNumber);
+          + rho * newElementNodes.at(nodeNumber);
     }
   }
   return newElementNodes;
 }
 
+// Get nodes in the target precision. Returns the given nodes if no conversion
+// is required. Otherwise, the converted nodes are stored in the given buffer,
+// which is returned.
+template <typename TargetScalar, typename SourceScalar>
+const std::vector<Mathematics::BasicVector2D<TargetScalar>>&
+getNodesInPrecision(
+    const std::vector<Mathematics::BasicVector2D<SourceScalar>>& nodes,
+    std::vector<Mathematics::BasicVector2D<TargetScalar>>& buffer) {
+  if constexpr (std::is_same_v<TargetScalar, SourceScalar>) {
+    return nodes;
+  } else {
+    Mathematics::convertVectors(nodes, buffer);
+    return buffer;
+  }
+}
+
+// Compute the mesh quality based on the given element mean ratio numbers
+// without determining the number of invalid elements. Instantiated for float
+// and double.
+template <typename Scalar>
+Mesh::MeshQuality computeMeshQuality(
+    const std::vector<Scalar>& polygonMeanRatioValues);
+
+// Compute the mesh quality of the given mesh for the given nodes, which may
+// differ from the mesh nodes. Instantiated for float and double.
+template <typename Scalar>
+Mesh::MeshQuality computeMeshQuality(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes);
+
+// Compute q_min* based on the given polygon mean ratio values. Not set if all
+// polygons are fixed. Instantiated for float and double.
+template <typename Scalar>
+std::optional<double> computeQMinStar(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues);
+
+// Check if the mesh with the given polygon mean ratio values and the mesh
+// quality computed from these reaches the given quality targets. q_min* is only
+// determined if targeted. Instantiated for float and double.
+template <typename Scalar>
+bool areQualityTargetsReached(
+    const QualityTargets& qualityTargets,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality);
+
+// Iteratively reset nodes of invalid mesh elements to their old positions to
+// preserve mesh validity after applying a quality based simultaneous smoothing
+// step. Element qualities are computed in the precision of the given nodes.
+// After an initial pass over all polygons, only polygons affected by the
+// resets of the previous round are reassessed. Updates the new node positions
+// and the polygon mean ratio values and returns the resulting mesh quality.
+// The times of quality evaluation and reset are added to the given phase times.
+// Instantiated for float and double.
+template <typename Scalar>
+Mesh::MeshQuality iterativelyResetNodesResultingInInvalidElements(
+    std::vector<Mathematics::BasicVector2D<Scalar>>& newNodePositions,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& oldNodePositions,
+    std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::PolygonalMesh& mesh,
+    InvalidElementResetBuffers& buffers,
+    Utility::PhaseTimes& phaseTimes);
+
 // Iteratively reset nodes of invalid mesh elements to preserve mesh validity
 // after applying a quality based simultaneous smoothing step. Updates all
 // provided parameters.
@@ -98,6 +180,126 @@ iterativelyResetNodesResultingInInvalidElementsSetNewMeshNodesAndUpdateElementQu
     std::vector<double>& polygonMeanRatioValuesForMesh,
     Mesh::PolygonalMesh& mesh);
 
+// Initialize the active set of simultaneous smoothing with all non fixed nodes.
+// Fixed nodes are permanently marked as contained in the next active set,
+// which prevents activating them.
+void initializeActiveSet(const Mesh::PolygonalMesh& mesh,
+                         ActiveSetBuffers& buffers);
+
+// Add the given node to the active set of the next iteration if it is neither
+// fixed nor already contained.
+inline void activateNodeInNextIteration(const std::size_t nodeIndex,
+                                        ActiveSetBuffers& buffers) {
+  if (!buffers.isNextActiveNode[nodeIndex]) {
+    buffers.isNextActiveNode[nodeIndex] = 1;
+    buffers.nextActiveNodeIndices.push_back(nodeIndex);
+  }
+}
+
+// Make the active set of the next iteration the current one.
+void advanceActiveSet(ActiveSetBuffers& buffers);
+
+// Add all non fixed nodes to the active set of the next iteration. Used to
+// check convergence for the whole mesh once the active nodes converged.
+void activateAllNonFixedNodesInNextIteration(const Mesh::PolygonalMesh& mesh,
+                                             ActiveSetBuffers& buffers);
+
+// Returns true if the current active set contains all non fixed nodes. Then,
+// the node relocation distances of the iteration cover the whole mesh.
+bool containsAllNonFixedNodes(const Mesh::PolygonalMesh& mesh,
+                              const ActiveSetBuffers& buffers);
+
+// Check that the given active set relocation distance fraction is in [0,1].
+void checkActiveSetRelocationDistanceFraction(const double fraction);
+
+// Add the momentum term beta*(x_k-x_{k-1}) of heavy ball acceleration to the
+// new position of a node with current position x_k and previous position
+// x_{k-1}.
+template <typename Scalar>
+inline Mathematics::BasicVector2D<Scalar> addMomentum(
+    const Mathematics::BasicVector2D<Scalar>& newNodePosition,
+    const Mathematics::BasicVector2D<Scalar>& currentNodePosition,
+    const Mathematics::BasicVector2D<Scalar>& previousNodePosition,
+    const Scalar momentumFactor) {
+  return newNodePosition
+         + momentumFactor * (currentNodePosition - previousNodePosition);
+}
+
+// Check that the given momentum factor is in [0,1).
+void checkMomentumFactor(const double momentumFactor);
+
+// Check that the given wall clock time limit is not negative.
+void checkMaxWallClockTime(const double maxWallClockTimeInSeconds);
+
+// Check if the elapsed time of the given active stop watch exceeds the given
+// wall clock time limit. The clock is not queried for infinite limits.
+inline bool isWallClockTimeExceeded(const Utility::StopWatch& stopWatch,
+                                    const double maxWallClockTimeInSeconds) {
+  return maxWallClockTimeInSeconds
+             != std::numeric_limits<double>::infinity()
+         && stopWatch.getElapsedTimeInSeconds() >= maxWallClockTimeInSeconds;
+}
+
+// Check that the iteration interval of the given observer is positive.
+void checkObserver(const SmoothingObserver& observer);
+
+// Notify the given observer, if it is attached and the given iteration is a
+// multiple of its iteration interval. The mesh quality of the current mesh is
+// only computed by the given function if the observer is notified. Returns
+// true if the observer requests cancellation.
+template <typename MeshQualityFunction>
+inline bool isCancelledByObserver(const SmoothingObserver& observer,
+                                  const std::string_view algorithmName,
+                                  const std::size_t iteration,
+                                  const Utility::StopWatch& stopWatch,
+                                  const MeshQualityFunction& getMeshQuality) {
+  if (!observer.isAttached() || iteration % observer.iterationInterval != 0) {
+    return false;
+  }
+  return !observer.callback(SmoothingProgress{
+      algorithmName, iteration, getMeshQuality(),
+      stopWatch.getElapsedTimeInSeconds()});
+}
+
+// Check if the convergence record of the given iteration is due for the given
+// convergence history interval, which disables recording if zero.
+inline bool isConvergenceRecordDue(const std::size_t convergenceHistoryInterval,
+                                   const std::size_t iteration) {
+  return convergenceHistoryInterval > 0
+         && iteration % convergenceHistoryInterval == 0;
+}
+
+// Compute the maximal relocation distance of the non fixed mesh nodes.
+// Instantiated for float and double.
+template <typename Scalar>
+double computeMaxNodeRelocationDistance(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& newNodePositions,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& oldNodePositions);
+
+// Create the convergence record of the mesh with the given polygon mean ratio
+// values and the mesh quality computed from these. The elapsed time is taken
+// from the given active stop watch. Instantiated for float and double.
+template <typename Scalar>
+ConvergenceRecord createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Scalar>& polygonMeanRatioValues,
+    const Mesh::MeshQuality& meshQuality,
+    const double maxNodeRelocationDistance,
+    const std::optional<std::size_t>& numberOfInvalidElementNodeResets,
+    const Utility::StopWatch& stopWatch);
+
+// Create the convergence record of the mesh with the given nodes, which may
+// differ from the mesh nodes. Instantiated for float and double.
+template <typename Scalar>
+ConvergenceRecord createConvergenceRecord(
+    const std::size_t iteration,
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    const double maxNodeRelocationDistance,
+    const Utility::StopWatch& stopWatch);
+
 // Check given transformations if they are suitable for GETMe smoothing for
 // meshes with the given maximal number of polygon nodes.
 void checkTransformations(
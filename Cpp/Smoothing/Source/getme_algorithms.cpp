@@ -22,16 +22,26 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Smoothing/getme_algorithms.h"
 
 #include "Mathematics/vector2d.h"
+#include "Mesh/mesh_coarsening.h"
+#include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
 #include "Smoothing/basic_getme_simultaneous_config.h"
+#include "Smoothing/convergence_history.h"
 #include "Smoothing/getme_config.h"
 #include "Smoothing/getme_result.h"
 #include "Smoothing/getme_sequential_config.h"
 #include "Smoothing/getme_simultaneous_config.h"
+#include "Smoothing/multilevel_getme_config.h"
+#include "Smoothing/multilevel_getme_result.h"
 #include "Smoothing/smoothing_result.h"
+#include "Smoothing/smoothing_workspace.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
+#include "Utility/memory_usage.h"
+#include "Utility/phase_timer.h"
 #include "Utility/stop_watch.h"
+#include "Utility/tracing.h"
 #include "common_algorithms.h"
 #include "getme_sequential.h"
 #include "polygon_quality_min_heap.h"
@@ -40,142 +50,736 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <cmath>
 #include <execution>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-Smoothing::SmoothingResult Smoothing::basicGetmeSimultaneous(
-    Mesh::PolygonalMesh mesh,
-    const BasicGetmeSimultaneousConfig& config) {
-  checkTransformations(mesh, config.polygonTransformations);
+namespace {
+using Precision = Smoothing::DefaultConfiguration::FloatingPointPrecision;
+
+// Write the non fixed nodes to the mesh. Fixed nodes are kept in double
+// precision.
+template <typename Scalar>
+void setNonFixedMeshNodes(
+    const std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    Mesh::PolygonalMesh& mesh) {
+  auto& meshNodes = mesh.getMutableNodes();
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    meshNodes.at(nodeIndex) = Mathematics::Vector2D(nodes.at(nodeIndex));
+  }
+}
+
+// Basic GETMe simultaneous smoothing loop updating the given nodes of the mesh
+// in the given scalar precision. In active set mode, only polygons with active
+// nodes are transformed and only active nodes are updated. The wall clock time
+// limit is checked using the given stop watch. Convergence records and phase
+// times are added to the given history and phase times. Returns the number of
+// iterations.
+template <typename Scalar>
+std::size_t basicGetmeSimultaneousIterations(
+    const Mesh::PolygonalMesh& mesh,
+    std::vector<Mathematics::BasicVector2D<Scalar>>& nodes,
+    const Smoothing::BasicGetmeSimultaneousConfig& config,
+    const Utility::StopWatch& stopWatch,
+    Smoothing::SmoothingWorkspace& workspace,
+    Smoothing::ConvergenceHistory& convergenceHistory,
+    Utility::PhaseTimes& phaseTimes) {
+  using Vector = Mathematics::BasicVector2D<Scalar>;
   std::size_t iteration = 0;
   const auto& polygons = mesh.getPolygons();
-  std::vector<Mathematics::Vector2D> newNodePositions(
-      mesh.getNumberOfNodes(), Mathematics::Vector2D(0.0, 0.0));
+  auto& newNodePositions = workspace.getBuffers<Scalar>().newNodePositions;
+  newNodePositions.assign(mesh.getNumberOfNodes(),
+                          Vector(Scalar(0), Scalar(0)));
+  const bool useActiveSet = config.activeSetRelocationDistanceFraction > 0.0;
+  const auto squaredFreezingDistance =
+      static_cast<Scalar>(config.activeSetRelocationDistanceFraction
+                          * config.activeSetRelocationDistanceFraction
+                          * config.maxSquaredNodeRelocationDistanceThreshold);
+  auto& activeSet = workspace.getActiveSetBuffers();
+  if (useActiveSet) {
+    Smoothing::initializeActiveSet(mesh, activeSet);
+  }
+  const auto momentumFactor = static_cast<Scalar>(config.momentumFactor);
+  auto& previousNodes = workspace.getBuffers<Scalar>().previousNodes;
+  if (momentumFactor > Scalar(0)) {
+    previousNodes = nodes;
+  }
 
-  Utility::StopWatch stopWatch;
   while (true) {
-    for (const auto& polygon : polygons) {
-      const auto numberOfPolygonNodes = polygon.getNumberOfNodes();
-      auto transformedNodes = transformAndScaleElement(
-          config.polygonTransformations.at(numberOfPolygonNodes), polygon,
-          mesh.getNodes());
-      for (std::size_t nodeNumber = 0; nodeNumber < numberOfPolygonNodes;
-           ++nodeNumber) {
-        newNodePositions.at(polygon.getNodeIndex(nodeNumber)) +=
-            transformedNodes.at(nodeNumber);
+    const Utility::ScopedTraceSpan traceSpan(
+        "Basic GETMe simultaneous iteration", iteration + 1);
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, "transformation");
+      if (useActiveSet) {
+        for (const auto nodeIndex : activeSet.activeNodeIndices) {
+          for (const auto polygonIndex :
+               mesh.getAttachedPolygonIndices(nodeIndex)) {
+            activeSet.isActivePolygon[polygonIndex] = 1;
+          }
+        }
+      }
+      // Polygons are processed in index order to obtain the same node sums as
+      // without active set for all active nodes.
+      for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+           ++polygonIndex) {
+        if (useActiveSet) {
+          if (!activeSet.isActivePolygon[polygonIndex]) {
+            continue;
+          }
+          activeSet.isActivePolygon[polygonIndex] = 0;
+        }
+        const auto& polygon = polygons.at(polygonIndex);
+        const auto numberOfPolygonNodes = polygon.getNumberOfNodes();
+        auto transformedNodes = Smoothing::transformAndScaleElement(
+            config.polygonTransformations.at(numberOfPolygonNodes), polygon,
+            nodes);
+        for (std::size_t nodeNumber = 0; nodeNumber < numberOfPolygonNodes;
+             ++nodeNumber) {
+          newNodePositions.at(polygon.getNodeIndex(nodeNumber)) +=
+              transformedNodes.at(nodeNumber);
+        }
       }
     }
-    double maxSquaredNodeRelocationDistance = 0.0;
-    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
-      const auto newNodePosition =
-          newNodePositions.at(nodeIndex)
-          / static_cast<double>(
-              mesh.getAttachedPolygonIndices(nodeIndex).size());
-      updateMaxSquaredNodeRelocationDistance(mesh.getNodes().at(nodeIndex),
-                                             newNodePosition,
-                                             maxSquaredNodeRelocationDistance);
-      mesh.getMutableNodes().at(nodeIndex) = newNodePosition;
+    Scalar maxSquaredNodeRelocationDistance = Scalar(0);
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, "node update");
+      for (const auto nodeIndex : useActiveSet
+                                      ? activeSet.activeNodeIndices
+                                      : mesh.getNonFixedNodeIndices()) {
+        auto newNodePosition =
+            newNodePositions.at(nodeIndex)
+            / static_cast<Scalar>(
+                mesh.getAttachedPolygonIndices(nodeIndex).size());
+        if (momentumFactor > Scalar(0)) {
+          newNodePosition = Smoothing::addMomentum(
+              newNodePosition, nodes.at(nodeIndex),
+              previousNodes.at(nodeIndex), momentumFactor);
+          previousNodes.at(nodeIndex) = nodes.at(nodeIndex);
+        }
+        const Scalar squaredNodeRelocationDistance =
+            (newNodePosition - nodes.at(nodeIndex)).getLengthSquared();
+        maxSquaredNodeRelocationDistance = std::max(
+            maxSquaredNodeRelocationDistance, squaredNodeRelocationDistance);
+        nodes.at(nodeIndex) = newNodePosition;
+        if (useActiveSet
+            && squaredNodeRelocationDistance > squaredFreezingDistance) {
+          // Nodes of attached polygons depend on the moved node.
+          for (const auto polygonIndex :
+               mesh.getAttachedPolygonIndices(nodeIndex)) {
+            for (const auto polygonNodeIndex :
+                 polygons.at(polygonIndex).getNodeIndices()) {
+              Smoothing::activateNodeInNextIteration(polygonNodeIndex,
+                                                     activeSet);
+            }
+          }
+        }
+      }
+    }
+    if (Smoothing::isConvergenceRecordDue(config.convergenceHistoryInterval,
+                                          iteration + 1)) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "convergence recording");
+      convergenceHistory.push_back(Smoothing::createConvergenceRecord(
+          iteration + 1, mesh, nodes,
+          std::sqrt(static_cast<double>(maxSquaredNodeRelocationDistance)),
+          stopWatch));
     }
+    // In active set mode, frozen nodes may still move farther than the
+    // threshold. Hence, convergence of the active nodes is confirmed by an
+    // iteration over all non fixed nodes.
+    const bool isConverged =
+        maxSquaredNodeRelocationDistance
+        <= config.maxSquaredNodeRelocationDistanceThreshold;
     if (++iteration == config.maxIterations
-        || maxSquaredNodeRelocationDistance
-               <= config.maxSquaredNodeRelocationDistanceThreshold) {
+        || (isConverged
+            && (!useActiveSet
+                || Smoothing::containsAllNonFixedNodes(mesh, activeSet)))
+        || Smoothing::isWallClockTimeExceeded(
+            stopWatch, config.maxWallClockTimeInSeconds)
+        || Smoothing::isCancelledByObserver(
+            config.observer, "Basic GETMe simultaneous", iteration, stopWatch,
+            [&]() { return Smoothing::computeMeshQuality(mesh, nodes); })) {
       break;
     }
+    if (useActiveSet) {
+      if (isConverged) {
+        Smoothing::activateAllNonFixedNodesInNextIteration(mesh, activeSet);
+      }
+      Smoothing::advanceActiveSet(activeSet);
+    }
     newNodePositions.assign(mesh.getNumberOfNodes(),
-                            Mathematics::Vector2D(0.0, 0.0));
+                            Vector(Scalar(0), Scalar(0)));
   }
-  stopWatch.stop();
-  return SmoothingResult("Basic GETMe simultaneous", mesh,
-                         stopWatch.getElapsedTimeInSeconds(), iteration);
+  return iteration;
 }
 
-Smoothing::SmoothingResult Smoothing::getmeSimultaneous(
-    Mesh::PolygonalMesh mesh,
-    const GetmeSimultaneousConfig& config) {
-  checkTransformations(mesh, config.polygonTransformations);
+// GETMe simultaneous smoothing loop. Polygons are transformed and new node
+// positions are computed in NodeScalar precision, whereas element qualities
+// and mesh validity are assessed in QualityScalar precision, which is also the
+// precision of the given nodes. In mixed precision, the transformation works on
+// node precision copies of the nodes, which are updated along with the nodes
+// instead of converting all nodes in each iteration. The given nodes have to
+// form a valid mesh with respect to QualityScalar precision and the given
+// polygon mean ratio values have to match these. The given nodes are set to
+// the nodes of the best mesh found. The wall clock time limit is checked using
+// the given stop watch. Scratch buffers of the given workspace are used and
+// convergence records and phase times are added to the given history and phase
+// times. Returns the number of iterations.
+template <typename NodeScalar, typename QualityScalar>
+std::size_t getmeSimultaneousIterations(
+    const Mesh::PolygonalMesh& mesh,
+    std::vector<Mathematics::BasicVector2D<QualityScalar>>& nodes,
+    std::vector<QualityScalar>& polygonMeanRatioValues,
+    const Smoothing::GetmeSimultaneousConfig& config,
+    const Utility::StopWatch& stopWatch,
+    Smoothing::SmoothingWorkspace& workspace,
+    Smoothing::ConvergenceHistory& convergenceHistory,
+    Utility::PhaseTimes& phaseTimes) {
+  using NodeVector = Mathematics::BasicVector2D<NodeScalar>;
+  using QualityVector = Mathematics::BasicVector2D<QualityScalar>;
   std::size_t iteration = 0;
   const auto& polygons = mesh.getPolygons();
-  auto polygonMeanRatioValues =
-      Mesh::computeMeanRatioQualityNumberOfPolygons(polygons, mesh.getNodes());
-  auto oldMeshQuality = Mesh::MeshQuality(polygonMeanRatioValues, false);
-  Utility::throwExceptionIfFalse(
-      oldMeshQuality.isValidMesh(),
-      "GETMe simultaneous can only be applied to valid initial meshes.");
-  std::vector<Mathematics::Vector2D> transformedNodeSums(
-      mesh.getNumberOfNodes(), Mathematics::Vector2D(0.0, 0.0));
-  auto newNodePositions = mesh.getNodes();
-  std::vector<double> nodeWeightSums(mesh.getNumberOfNodes(), 0.0);
+  auto& nodeBuffers = workspace.getBuffers<NodeScalar>();
+  auto& qualityBuffers = workspace.getBuffers<QualityScalar>();
+  auto oldMeshQuality = Smoothing::computeMeshQuality(polygonMeanRatioValues);
+  auto& transformedNodeSums = nodeBuffers.transformedNodeSums;
+  transformedNodeSums.assign(mesh.getNumberOfNodes(),
+                             NodeVector(NodeScalar(0), NodeScalar(0)));
+  // Only used if node and quality precision differ.
+  auto& transformationNodesBuffer = nodeBuffers.nodes;
+  constexpr bool isMixedPrecision =
+      !std::is_same_v<NodeScalar, QualityScalar>;
+  const auto& transformationNodes =
+      Smoothing::getNodesInPrecision(nodes, transformationNodesBuffer);
+  auto& newNodePositions = qualityBuffers.newNodePositions;
+  newNodePositions = nodes;
+  auto& nodeWeightSums = nodeBuffers.nodeWeightSums;
+  nodeWeightSums.assign(mesh.getNumberOfNodes(), NodeScalar(0));
   double bestQMeanValue = oldMeshQuality.getQMean();
-  auto bestQMeanNodes = mesh.getNodes();
+  auto& bestQMeanNodes = qualityBuffers.bestQMeanNodes;
+  bestQMeanNodes = nodes;
+  const auto saturationWeightThreshold =
+      static_cast<NodeScalar>(config.saturationWeightThreshold);
+  const auto momentumFactor = static_cast<QualityScalar>(config.momentumFactor);
+  auto& previousNodes = qualityBuffers.previousNodes;
+  if (momentumFactor > QualityScalar(0)) {
+    previousNodes = nodes;
+  }
 
-  Utility::StopWatch stopWatch;
   while (true) {
-    // Transform all polygons and sum up nodes.
-    for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
-         ++polygonIndex) {
-      const auto& polygon = polygons.at(polygonIndex);
-      const auto numberOfPolygonNodes = polygon.getNumberOfNodes();
-      auto transformedNodes = transformScaleAndRelaxElement(
-          config.polygonTransformations.at(numberOfPolygonNodes),
-          config.relaxationParameterRho, polygon, mesh.getNodes());
-      const double weight =
-          config.weightExponentEta == 0.0
-              ? 1.0
-              : std::pow(1.0 - polygonMeanRatioValues.at(polygonIndex),
-                         config.weightExponentEta);
-      for (std::size_t nodeNumber = 0; nodeNumber < numberOfPolygonNodes;
-           ++nodeNumber) {
-        const auto nodeIndex = polygon.getNodeIndex(nodeNumber);
-        transformedNodeSums.at(nodeIndex) +=
-            weight * transformedNodes.at(nodeNumber);
-        nodeWeightSums.at(nodeIndex) += weight;
+    const Utility::ScopedTraceSpan traceSpan("GETMe simultaneous iteration",
+                                             iteration + 1);
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, "transformation");
+      // Transform all polygons and sum up nodes.
+      for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+           ++polygonIndex) {
+        const auto& polygon = polygons.at(polygonIndex);
+        const auto numberOfPolygonNodes = polygon.getNumberOfNodes();
+        const NodeScalar weight =
+            config.weightExponentEta == 0.0
+                ? NodeScalar(1)
+                : std::pow(NodeScalar(1)
+                               - static_cast<NodeScalar>(
+                                   polygonMeanRatioValues.at(polygonIndex)),
+                           static_cast<NodeScalar>(config.weightExponentEta));
+        if (weight < saturationWeightThreshold) {
+          // Saturated polygon contributes its current nodes.
+          for (const auto nodeIndex : polygon.getNodeIndices()) {
+            transformedNodeSums.at(nodeIndex) +=
+                weight * transformationNodes.at(nodeIndex);
+            nodeWeightSums.at(nodeIndex) += weight;
+          }
+          continue;
+        }
+        auto transformedNodes = Smoothing::transformScaleAndRelaxElement(
+            config.polygonTransformations.at(numberOfPolygonNodes),
+            config.relaxationParameterRho, polygon, transformationNodes);
+        for (std::size_t nodeNumber = 0; nodeNumber < numberOfPolygonNodes;
+             ++nodeNumber) {
+          const auto nodeIndex = polygon.getNodeIndex(nodeNumber);
+          transformedNodeSums.at(nodeIndex) +=
+              weight * transformedNodes.at(nodeNumber);
+          nodeWeightSums.at(nodeIndex) += weight;
+        }
       }
     }
-    // Compute new nodes and assess.
-    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
-      if (nodeWeightSums.at(nodeIndex) > 0.0) {
-        newNodePositions.at(nodeIndex) =
-            transformedNodeSums.at(nodeIndex) / nodeWeightSums.at(nodeIndex);
+    // Compute new nodes and assess. Nodes resulting in invalid elements are
+    // reset, which also limits momentum acceleration.
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, "node update");
+      for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+        if (nodeWeightSums.at(nodeIndex) > NodeScalar(0)) {
+          newNodePositions.at(nodeIndex) =
+              QualityVector(transformedNodeSums.at(nodeIndex)
+                            / nodeWeightSums.at(nodeIndex));
+          if (momentumFactor > QualityScalar(0)) {
+            newNodePositions.at(nodeIndex) = Smoothing::addMomentum(
+                newNodePositions.at(nodeIndex), nodes.at(nodeIndex),
+                previousNodes.at(nodeIndex), momentumFactor);
+          }
+          if constexpr (isMixedPrecision) {
+            transformationNodesBuffer.at(nodeIndex) =
+                NodeVector(newNodePositions.at(nodeIndex));
+          }
+        }
       }
     }
     const auto newMeshQuality =
-        iterativelyResetNodesResultingInInvalidElementsSetNewMeshNodesAndUpdateElementQualityNumbers(
-            newNodePositions, polygonMeanRatioValues, mesh);
+        Smoothing::iterativelyResetNodesResultingInInvalidElements(
+            newNodePositions, nodes, polygonMeanRatioValues, mesh,
+            workspace.getInvalidElementResetBuffers(), phaseTimes);
+    if constexpr (isMixedPrecision) {
+      for (const auto nodeIndex :
+           workspace.getInvalidElementResetBuffers().indicesOfResetNodes) {
+        transformationNodesBuffer.at(nodeIndex) =
+            NodeVector(nodes.at(nodeIndex));
+      }
+    }
+    if (Smoothing::isConvergenceRecordDue(config.convergenceHistoryInterval,
+                                          iteration + 1)) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "convergence recording");
+      convergenceHistory.push_back(Smoothing::createConvergenceRecord(
+          iteration + 1, mesh, polygonMeanRatioValues, newMeshQuality,
+          Smoothing::computeMaxNodeRelocationDistance(mesh, newNodePositions,
+                                                      nodes),
+          workspace.getInvalidElementResetBuffers().indicesOfResetNodes.size(),
+          stopWatch));
+    }
+    if (momentumFactor > QualityScalar(0)) {
+      previousNodes = nodes;
+    }
+    nodes = newNodePositions;
     if (bestQMeanValue < newMeshQuality.getQMean()) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "best mesh copying");
       bestQMeanValue = newMeshQuality.getQMean();
-      bestQMeanNodes = mesh.getNodes();
+      bestQMeanNodes = nodes;
+    }
+    // A mesh reaching the quality targets is returned, even if it is not the
+    // best mesh with respect to q_mean.
+    const bool areQualityTargetsReached =
+        config.qualityTargets.isSet()
+        && Smoothing::areQualityTargetsReached(config.qualityTargets, mesh,
+                                               polygonMeanRatioValues,
+                                               newMeshQuality);
+    if (areQualityTargetsReached) {
+      bestQMeanNodes = nodes;
     }
     // Check termination criteria and set data.
     if (const double qMeanImprovement =
             newMeshQuality.getQMean() - oldMeshQuality.getQMean();
-        ++iteration == config.maxIterations
-        || qMeanImprovement <= config.qMeanImprovementThreshold) {
+        ++iteration == config.maxIterations || areQualityTargetsReached
+        || qMeanImprovement <= config.qMeanImprovementThreshold
+        || Smoothing::isWallClockTimeExceeded(
+            stopWatch, config.maxWallClockTimeInSeconds)
+        || Smoothing::isCancelledByObserver(
+            config.observer, "GETMe simultaneous", iteration, stopWatch,
+            [&]() { return newMeshQuality; })) {
       break;
     }
     oldMeshQuality = newMeshQuality;
     transformedNodeSums.assign(mesh.getNumberOfNodes(),
-                               Mathematics::Vector2D(0.0, 0.0));
-    nodeWeightSums.assign(mesh.getNumberOfNodes(), 0.0);
-    newNodePositions = mesh.getNodes();
+                               NodeVector(NodeScalar(0), NodeScalar(0)));
+    nodeWeightSums.assign(mesh.getNumberOfNodes(), NodeScalar(0));
+  }
+
+  nodes = bestQMeanNodes;
+  return iteration;
+}
+
+// Build the coarse levels of the node aggregation hierarchy. The first entry
+// is derived from the given mesh, each further entry from its predecessor.
+std::vector<Mesh::CoarsenedMesh> buildCoarseLevels(
+    const Mesh::PolygonalMesh& mesh,
+    const Smoothing::MultilevelGetmeConfig& config) {
+  std::vector<Mesh::CoarsenedMesh> coarseLevels;
+  while (coarseLevels.size() < config.maxNumberOfCoarseLevels) {
+    const auto& finerMesh =
+        coarseLevels.empty() ? mesh : coarseLevels.back().mesh;
+    auto coarsenedMesh = Mesh::coarsenMesh(finerMesh);
+    if (coarsenedMesh.mesh.getNumberOfNodes() == finerMesh.getNumberOfNodes()
+        || coarsenedMesh.mesh.getNonFixedNodeIndices().size()
+               < config.minNumberOfCoarseNonFixedNodes) {
+      break;
+    }
+    coarseLevels.push_back(std::move(coarsenedMesh));
+  }
+  return coarseLevels;
+}
+
+// Smooth the given coarse level mesh by basic GETMe simultaneous starting from
+// the given node positions, e.g. the restricted nodes of the finest level.
+// Since coarse polygons span several finer polygons, large scale distortions
+// are reduced within few iterations. Returns the displacements of the coarse
+// nodes.
+std::vector<Mathematics::Vector2D> computeCoarseLevelDisplacements(
+    const Mesh::PolygonalMesh& coarseMesh,
+    const std::vector<Mathematics::Vector2D>& coarseNodes,
+    const Smoothing::BasicGetmeSimultaneousConfig& coarseLevelConfig,
+    Smoothing::SmoothingWorkspace& workspace) {
+  auto displacements = coarseNodes;
+  const Utility::StopWatch stopWatch;
+  Smoothing::ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
+  basicGetmeSimultaneousIterations(coarseMesh, displacements,
+                                   coarseLevelConfig, stopWatch, workspace,
+                                   convergenceHistory, phaseTimes);
+  for (std::size_t nodeIndex = 0; nodeIndex < coarseNodes.size();
+       ++nodeIndex) {
+    displacements.at(nodeIndex) =
+        displacements.at(nodeIndex) - coarseNodes.at(nodeIndex);
+  }
+  return displacements;
+}
+
+// Get the mean quality of the mesh with the given nodes or -1 if the mesh is
+// invalid.
+double getQMean(const Mesh::PolygonalMesh& mesh,
+                const std::vector<Mathematics::Vector2D>& nodes,
+                std::vector<double>& polygonMeanRatioValues) {
+  Mesh::computeMeanRatioQualityNumberOfPolygons(mesh.getPolygons(), nodes,
+                                                polygonMeanRatioValues);
+  return Smoothing::computeMeshQuality(polygonMeanRatioValues).getQMean();
+}
+
+// Add the given node corrections scaled by a step length determined by line
+// search. Starting with one, the step length is doubled as long as the mean
+// mesh quality improves or halved until it improves. The mesh is not modified
+// if no improving step length is found.
+void applyCorrectionByLineSearch(
+    const std::vector<Mathematics::Vector2D>& corrections,
+    Smoothing::SmoothingWorkspace& workspace,
+    Mesh::PolygonalMesh& mesh) {
+  constexpr double maxStepLength = 64.0;
+  constexpr double minStepLength = 1.0 / 64.0;
+  auto& polygonMeanRatioValues =
+      workspace.getBuffers<double>().polygonMeanRatioValues;
+  polygonMeanRatioValues.resize(mesh.getNumberOfPolygons());
+  auto& newNodes = workspace.getBuffers<double>().newNodePositions;
+  const auto getQMeanForStepLength = [&](const double stepLength) {
+    newNodes = mesh.getNodes();
+    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+      newNodes.at(nodeIndex) += stepLength * corrections.at(nodeIndex);
+    }
+    return getQMean(mesh, newNodes, polygonMeanRatioValues);
+  };
+
+  double bestQMean = getQMean(mesh, mesh.getNodes(), polygonMeanRatioValues);
+  double bestStepLength = 0.0;
+  for (double stepLength = 1.0; stepLength <= maxStepLength;
+       stepLength *= 2.0) {
+    const double qMean = getQMeanForStepLength(stepLength);
+    if (qMean <= bestQMean) {
+      break;
+    }
+    bestQMean = qMean;
+    bestStepLength = stepLength;
+  }
+  for (double stepLength = 0.5;
+       bestStepLength == 0.0 && stepLength >= minStepLength;
+       stepLength /= 2.0) {
+    if (getQMeanForStepLength(stepLength) > bestQMean) {
+      bestStepLength = stepLength;
+    }
+  }
+  if (bestStepLength > 0.0) {
+    auto& nodes = mesh.getMutableNodes();
+    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+      nodes.at(nodeIndex) += bestStepLength * corrections.at(nodeIndex);
+    }
+  }
+}
+
+// Correct the given finest level mesh by smoothing the coarse level with the
+// given index. The nodes of the mesh are restricted to the coarse level, the
+// displacements of the smoothed coarse level are prolongated to the finest
+// level and applied by line search.
+void correctByCoarseLevel(
+    const std::vector<Mesh::CoarsenedMesh>& coarseLevels,
+    const std::size_t levelIndex,
+    const Smoothing::BasicGetmeSimultaneousConfig& coarseLevelConfig,
+    Smoothing::SmoothingWorkspace& workspace,
+    Mesh::PolygonalMesh& mesh) {
+  auto coarseNodes = mesh.getNodes();
+  for (std::size_t index = 0; index <= levelIndex; ++index) {
+    coarseNodes =
+        Mesh::restrictToCoarseMesh(coarseNodes, coarseLevels.at(index));
+  }
+  auto displacements = computeCoarseLevelDisplacements(
+      coarseLevels.at(levelIndex).mesh, coarseNodes, coarseLevelConfig,
+      workspace);
+  for (std::size_t index = levelIndex + 1; index > 0; --index) {
+    const auto& finerMesh =
+        index == 1 ? mesh : coarseLevels.at(index - 2).mesh;
+    displacements = Mesh::prolongateDisplacements(
+        displacements, coarseLevels.at(index - 1), finerMesh);
+  }
+  applyCorrectionByLineSearch(displacements, workspace, mesh);
+}
+}  // namespace
+
+Smoothing::SmoothingResult Smoothing::basicGetmeSimultaneous(
+    Mesh::PolygonalMesh mesh,
+    const BasicGetmeSimultaneousConfig& config) {
+  SmoothingWorkspace workspace;
+  return basicGetmeSimultaneous(std::move(mesh), config, workspace);
+}
+
+Smoothing::SmoothingResult Smoothing::basicGetmeSimultaneous(
+    Mesh::PolygonalMesh mesh,
+    const BasicGetmeSimultaneousConfig& config,
+    SmoothingWorkspace& workspace) {
+  checkTransformations(mesh, config.polygonTransformations);
+  checkActiveSetRelocationDistanceFraction(
+      config.activeSetRelocationDistanceFraction);
+  checkMomentumFactor(config.momentumFactor);
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  checkObserver(config.observer);
+  std::size_t iteration = 0;
+  ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
+
+  const auto initialEventCounts = Utility::getEventCounts();
+  Utility::StopWatch stopWatch;
+  if (config.floatingPointPrecision == Precision::Double) {
+    iteration = basicGetmeSimultaneousIterations(
+        mesh, mesh.getMutableNodes(), config, stopWatch, workspace,
+        convergenceHistory, phaseTimes);
+  } else {
+    // Without quality assessment, mixed precision equals single precision.
+    auto& nodes = workspace.getBuffers<float>().nodes;
+    Mathematics::convertVectors(mesh.getNodes(), nodes);
+    iteration = basicGetmeSimultaneousIterations(mesh, nodes, config, stopWatch,
+                                                 workspace, convergenceHistory,
+                                                 phaseTimes);
+    setNonFixedMeshNodes(nodes, mesh);
   }
   stopWatch.stop();
+  return SmoothingResult("Basic GETMe simultaneous", mesh,
+                         stopWatch.getElapsedTimeInSeconds(), iteration,
+                         std::move(convergenceHistory), std::move(phaseTimes),
+                         Utility::getEventCounts() - initialEventCounts,
+                         workspace.getCapacityInBytes());
+}
+
+Smoothing::SmoothingResult Smoothing::getmeSimultaneous(
+    Mesh::PolygonalMesh mesh,
+    const GetmeSimultaneousConfig& config) {
+  SmoothingWorkspace workspace;
+  return getmeSimultaneous(std::move(mesh), config, workspace);
+}
+
+Smoothing::SmoothingResult Smoothing::getmeSimultaneous(
+    Mesh::PolygonalMesh mesh,
+    const GetmeSimultaneousConfig& config,
+    SmoothingWorkspace& workspace) {
+  checkTransformations(mesh, config.polygonTransformations);
+  Utility::throwExceptionIfFalse(
+      config.saturationWeightThreshold >= 0.0
+          && config.saturationWeightThreshold < 1.0,
+      "Saturation weight threshold must be in [0,1).");
+  checkMomentumFactor(config.momentumFactor);
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  checkObserver(config.observer);
+  std::size_t iteration = 0;
+  const auto& polygons = mesh.getPolygons();
+  auto& polygonMeanRatioValues =
+      workspace.getBuffers<double>().polygonMeanRatioValues;
+  polygonMeanRatioValues.resize(polygons.size());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(polygons, mesh.getNodes(),
+                                                polygonMeanRatioValues);
+  Utility::throwExceptionIfFalse(
+      Mesh::MeshQuality(polygonMeanRatioValues, false).isValidMesh(),
+      "GETMe simultaneous can only be applied to valid initial meshes.");
 
-  mesh.getMutableNodes() = bestQMeanNodes;
+  ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
+  const auto initialEventCounts = Utility::getEventCounts();
+  Utility::StopWatch stopWatch;
+  auto precision = config.floatingPointPrecision;
+  if (precision == Precision::Single) {
+    auto& singlePrecisionBuffers = workspace.getBuffers<float>();
+    auto& nodes = singlePrecisionBuffers.nodes;
+    Mathematics::convertVectors(mesh.getNodes(), nodes);
+    auto& singlePrecisionMeanRatioValues =
+        singlePrecisionBuffers.polygonMeanRatioValues;
+    singlePrecisionMeanRatioValues.resize(polygons.size());
+    Mesh::computeMeanRatioQualityNumberOfPolygons(
+        polygons, nodes, singlePrecisionMeanRatioValues);
+    if (computeMeshQuality(singlePrecisionMeanRatioValues).isValidMesh()) {
+      iteration = getmeSimultaneousIterations<float>(
+          mesh, nodes, singlePrecisionMeanRatioValues, config, stopWatch,
+          workspace, convergenceHistory, phaseTimes);
+      setNonFixedMeshNodes(nodes, mesh);
+    } else {
+      // Nearly degenerate elements might be invalid with respect to single
+      // precision. Validate in double precision instead.
+      precision = Precision::Mixed;
+    }
+  }
+  if (precision == Precision::Double) {
+    iteration = getmeSimultaneousIterations<double>(
+        mesh, mesh.getMutableNodes(), polygonMeanRatioValues, config,
+        stopWatch, workspace, convergenceHistory, phaseTimes);
+  } else if (precision == Precision::Mixed) {
+    iteration = getmeSimultaneousIterations<float>(
+        mesh, mesh.getMutableNodes(), polygonMeanRatioValues, config,
+        stopWatch, workspace, convergenceHistory, phaseTimes);
+  }
+  stopWatch.stop();
   return SmoothingResult("GETMe simultaneous", mesh,
-                         stopWatch.getElapsedTimeInSeconds(), iteration);
+                         stopWatch.getElapsedTimeInSeconds(), iteration,
+                         std::move(convergenceHistory), std::move(phaseTimes),
+                         Utility::getEventCounts() - initialEventCounts,
+                         workspace.getCapacityInBytes());
 }
 
 Smoothing::SmoothingResult Smoothing::getmeSequential(
     const Mesh::PolygonalMesh& mesh,
     const GetmeSequentialConfig& config) {
+  SmoothingWorkspace workspace;
+  return getmeSequential(mesh, config, workspace);
+}
+
+Smoothing::SmoothingResult Smoothing::getmeSequential(
+    const Mesh::PolygonalMesh& mesh,
+    const GetmeSequentialConfig& config,
+    SmoothingWorkspace& workspace) {
   // Since GETMe sequential uses more helper data, an algorithm class is used.
-  GetmeSequential algorithm(mesh, config);
+  GetmeSequential algorithm(mesh, config, workspace);
   return algorithm.getResult();
 }
 
 Smoothing::GetmeResult Smoothing::getme(const Mesh::PolygonalMesh& mesh,
                                         const GetmeConfig& config) {
+  SmoothingWorkspace workspace;
+  return getme(mesh, config, workspace);
+}
+
+Smoothing::GetmeResult Smoothing::getme(const Mesh::PolygonalMesh& mesh,
+                                        const GetmeConfig& config,
+                                        SmoothingWorkspace& workspace) {
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  Utility::throwExceptionIfFalse(
+      config.getmeSimultaneousWallClockTimeFraction >= 0.0
+          && config.getmeSimultaneousWallClockTimeFraction <= 1.0,
+      "GETMe simultaneous wall clock time fraction must be in [0,1].");
+  auto getmeSimultaneousConfig = config.getmeSimultaneousConfig;
+  auto getmeSequentialConfig = config.getmeSequentialConfig;
+  if (config.qualityTargets.isSet()) {
+    getmeSimultaneousConfig.qualityTargets = config.qualityTargets;
+    getmeSequentialConfig.qualityTargets = config.qualityTargets;
+  }
+  if (config.convergenceHistoryInterval > 0) {
+    getmeSimultaneousConfig.convergenceHistoryInterval =
+        config.convergenceHistoryInterval;
+    getmeSequentialConfig.convergenceHistoryInterval =
+        config.convergenceHistoryInterval;
+  }
+  if (config.observer.isAttached()) {
+    getmeSimultaneousConfig.observer = config.observer;
+    getmeSequentialConfig.observer = config.observer;
+  }
+  bool isGetmeSimultaneousCancelled = false;
+  if (getmeSimultaneousConfig.observer.isAttached()) {
+    getmeSimultaneousConfig.observer.callback =
+        [&isGetmeSimultaneousCancelled,
+         callback = getmeSimultaneousConfig.observer.callback](
+            const SmoothingProgress& progress) {
+          isGetmeSimultaneousCancelled = !callback(progress);
+          return !isGetmeSimultaneousCancelled;
+        };
+  }
+  // Split the time budget. GETMe sequential also gets the time not used by
+  // GETMe simultaneous.
+  const bool isWallClockTimeLimited =
+      config.maxWallClockTimeInSeconds
+      != DefaultConfiguration::maxWallClockTimeInSeconds;
+  if (isWallClockTimeLimited) {
+    getmeSimultaneousConfig.maxWallClockTimeInSeconds =
+        std::min(getmeSimultaneousConfig.maxWallClockTimeInSeconds,
+                 config.getmeSimultaneousWallClockTimeFraction
+                     * config.maxWallClockTimeInSeconds);
+  }
   const auto getmeSimultaneousResult =
-      getmeSimultaneous(mesh, config.getmeSimultaneousConfig);
-  const auto getmeSequentialResult = getmeSequential(
-      getmeSimultaneousResult.mesh, config.getmeSequentialConfig);
+      getmeSimultaneous(mesh, getmeSimultaneousConfig, workspace);
+  if (isGetmeSimultaneousCancelled
+      || (config.qualityTargets.isSet()
+          && config.qualityTargets.isReachedBy(
+              getmeSimultaneousResult.meshQuality))) {
+    return GetmeResult(getmeSimultaneousResult,
+                       SmoothingResult("GETMe sequential",
+                                       getmeSimultaneousResult.mesh, 0.0, 0));
+  }
+  if (isWallClockTimeLimited) {
+    getmeSequentialConfig.maxWallClockTimeInSeconds =
+        std::min(getmeSequentialConfig.maxWallClockTimeInSeconds,
+                 std::max(0.0, config.maxWallClockTimeInSeconds
+                                   - getmeSimultaneousResult
+                                         .smoothingWallClockTimeInSeconds));
+  }
+  const auto getmeSequentialResult =
+      getmeSequential(getmeSimultaneousResult.mesh, getmeSequentialConfig,
+                      workspace);
   return GetmeResult(getmeSimultaneousResult, getmeSequentialResult);
 }
+
+Smoothing::MultilevelGetmeResult Smoothing::multilevelGetme(
+    const Mesh::PolygonalMesh& mesh,
+    const MultilevelGetmeConfig& config) {
+  Utility::throwExceptionIfFalse(
+      Mesh::MeshQuality(mesh).isValidMesh(),
+      "Multilevel GETMe can only be applied to valid initial meshes.");
+  Utility::PhaseTimes phaseTimes;
+  const auto initialEventCounts = Utility::getEventCounts();
+  Utility::StopWatch stopWatch;
+  std::vector<Mesh::CoarsenedMesh> coarseLevels;
+  {
+    const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                               "coarse level construction");
+    const Utility::ScopedTraceSpan traceSpan("coarse level construction");
+    coarseLevels = buildCoarseLevels(mesh, config);
+  }
+  // Coarse levels are smoothed by a fixed number of basic GETMe simultaneous
+  // iterations.
+  std::vector<BasicGetmeSimultaneousConfig> coarseLevelConfigs;
+  for (const auto& coarseLevel : coarseLevels) {
+    auto& coarseLevelConfig = coarseLevelConfigs.emplace_back(
+        0.0, coarseLevel.mesh.getMaximalNumberOfPolygonNodes());
+    coarseLevelConfig.maxIterations = config.coarseLevelIterations;
+  }
+  SmoothingWorkspace workspace;
+  auto correctedMesh = mesh;
+  for (std::size_t cycle = 0; cycle < config.numberOfCycles; ++cycle) {
+    // Proceed from the coarsest to the finest level.
+    for (std::size_t levelIndex = coarseLevels.size(); levelIndex > 0;
+         --levelIndex) {
+      const Utility::ScopedTraceSpan traceSpan("coarse level correction",
+                                               levelIndex);
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "coarse level correction");
+      correctByCoarseLevel(coarseLevels, levelIndex - 1,
+                           coarseLevelConfigs.at(levelIndex - 1), workspace,
+                           correctedMesh);
+    }
+  }
+  stopWatch.stop();
+  const auto coarseLevelsEventCounts =
+      Utility::getEventCounts() - initialEventCounts;
+  // The workspace is reused by GETMe, which reports its capacity.
+  std::size_t coarseLevelsScratchMemoryInBytes =
+      Utility::getMemoryUsage(coarseLevels).bytes;
+  for (const auto& coarseLevel : coarseLevels) {
+    coarseLevelsScratchMemoryInBytes +=
+        coarseLevel.mesh.getMemoryUsage().getTotal().bytes
+        + Utility::getMemoryUsage(coarseLevel.aggregateIndices).bytes;
+  }
+  return MultilevelGetmeResult(getme(correctedMesh, config.getmeConfig,
+                                     workspace),
+                               coarseLevels.size(),
+                               stopWatch.getElapsedTimeInSeconds(), phaseTimes,
+                               coarseLevelsEventCounts,
+                               coarseLevelsScratchMemoryInBytes);
+}
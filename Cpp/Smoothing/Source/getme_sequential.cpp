@@ -22,16 +22,56 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 // the GETMe book.
 #include "getme_sequential.h"
 
+#include "Mesh/mesh_quality.h"
 #include "Smoothing/smoothing_result.h"
+#include "Utility/event_counters.h"
+#include "Utility/memory_usage.h"
+#include "Utility/phase_timer.h"
 #include "Utility/stop_watch.h"
+#include "Utility/tracing.h"
 #include "common_algorithms.h"
 
+#include <algorithm>
+#include <cmath>
 #include <execution>
+#include <limits>
+#include <optional>
 
 namespace Smoothing {
+std::size_t GetmeSequentialBuffers::getCapacityInBytes() const {
+  return minHeap.getCapacityInBytes()
+         + Utility::getMemoryUsage(isNodeFixed).bytes
+         + Utility::getMemoryUsage(temporaryNodes).bytes
+         + Utility::getMemoryUsage(bestQMinStarNodes).bytes
+         + Utility::getMemoryUsage(affectedNeighborOffsets).bytes
+         + Utility::getMemoryUsage(affectedNeighborPolygonIndices).bytes
+         + Utility::getMemoryUsage(markingPolygonIndices).bytes
+         + Utility::getMemoryUsage(movedNodeIndices).bytes
+         + (meanRatioCornerCache ? meanRatioCornerCache->getCapacityInBytes()
+                                 : 0)
+         + Utility::getMemoryUsage(polygonMeanRatioValues).bytes;
+}
+
 GetmeSequential::GetmeSequential(const Mesh::PolygonalMesh& mesh,
-                                 const GetmeSequentialConfig& config)
-  : mesh(mesh), config(config), minHeap(mesh) {
+                                 const GetmeSequentialConfig& config,
+                                 SmoothingWorkspace& workspace)
+  : mesh(mesh)
+  , config(config)
+  , workspace(workspace)
+  , minHeap(workspace.getGetmeSequentialBuffers().minHeap)
+  , isNodeFixed(workspace.getGetmeSequentialBuffers().isNodeFixed)
+  , temporaryNodes(workspace.getGetmeSequentialBuffers().temporaryNodes)
+  , bestQMinStarNodes(workspace.getGetmeSequentialBuffers().bestQMinStarNodes)
+  , affectedNeighborOffsets(
+        workspace.getGetmeSequentialBuffers().affectedNeighborOffsets)
+  , affectedNeighborPolygonIndices(
+        workspace.getGetmeSequentialBuffers().affectedNeighborPolygonIndices)
+  , markingPolygonIndices(
+        workspace.getGetmeSequentialBuffers().markingPolygonIndices)
+  , movedNodeIndices(workspace.getGetmeSequentialBuffers().movedNodeIndices)
+  , polygonMeanRatioValues(
+        workspace.getGetmeSequentialBuffers().polygonMeanRatioValues) {
+  minHeap.init(this->mesh, polygonMeanRatioValues);
   checkInputData();
   initHelperData();
   applySmoothing();
@@ -41,7 +81,8 @@ GetmeSequential::GetmeSequential(const Mesh::PolygonalMesh& mesh,
 
 SmoothingResult GetmeSequential::getResult() const {
   return SmoothingResult("GETMe sequential", mesh, smoothingTimeInSeconds,
-                         iterationsApplied);
+                         iterationsApplied, convergenceHistory, phaseTimes,
+                         eventCounts, workspace.getCapacityInBytes());
 }
 
 void GetmeSequential::checkInputData() const {
@@ -53,18 +94,70 @@ void GetmeSequential::checkInputData() const {
       "Quality evaluation cycle length must be <= maximal number of "
       "iterations.");
   checkTransformations(mesh, config.polygonTransformations);
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  checkObserver(config.observer);
 }
 
 void GetmeSequential::initHelperData() {
-  isNodeFixed = std::vector<bool>(mesh.getNumberOfNodes(), false);
+  isNodeFixed.assign(mesh.getNumberOfNodes(), 0);
   const auto setNodeFixed = [this](const std::size_t fixedNodeIndex) {
-    isNodeFixed.at(fixedNodeIndex) = true;
+    isNodeFixed.at(fixedNodeIndex) = 1;
   };
   const auto& fixedNodeIndices = mesh.getFixedNodeIndices();
   std::for_each(std::execution::par_unseq, fixedNodeIndices.begin(),
                 fixedNodeIndices.end(), setNodeFixed);
 
+  initAffectedNeighborPolygonIndices();
   temporaryNodes = mesh.getNodes();
+  movedNodeIndices.clear();
+  if (Mesh::MeanRatioCornerCache::isBeneficialFor(mesh)) {
+    auto& cache = workspace.getGetmeSequentialBuffers().meanRatioCornerCache;
+    if (cache) {
+      cache->reset(mesh);
+    } else {
+      cache.emplace(mesh);
+    }
+    meanRatioCornerCache = &*cache;
+  }
+  const auto& qualityTargets = config.qualityTargets;
+  isQMinStarTargetCheckedEachIteration =
+      qualityTargets.qMinStar && !qualityTargets.qMin && !qualityTargets.qMean;
+  if (isQMinStarTargetCheckedEachIteration) {
+    initNumberOfPolygonsBelowQMinStarTarget();
+  }
+}
+
+void GetmeSequential::initAffectedNeighborPolygonIndices() {
+  const auto& polygons = mesh.getPolygons();
+  // Marking the polygon index avoids resetting markers for each polygon.
+  markingPolygonIndices.assign(mesh.getNumberOfNodes(),
+                               std::numeric_limits<std::size_t>::max());
+  affectedNeighborOffsets.assign(1, 0);
+  affectedNeighborOffsets.reserve(polygons.size() + 1);
+  affectedNeighborPolygonIndices.clear();
+  for (std::size_t polygonIndex = 0; polygonIndex < polygons.size();
+       ++polygonIndex) {
+    for (const auto nodeIndex : polygons.at(polygonIndex).getNodeIndices()) {
+      if (!isNodeFixed.at(nodeIndex)) {
+        markingPolygonIndices.at(nodeIndex) = polygonIndex;
+      }
+    }
+    // Neighbors keep the iteration order of the mesh topology data to retain
+    // the order of min heap updates.
+    for (const auto neighborPolygonIndex :
+         mesh.getIndicesOfNeighborPolygons(polygonIndex)) {
+      const auto& neighborNodeIndices =
+          polygons.at(neighborPolygonIndex).getNodeIndices();
+      if (std::any_of(neighborNodeIndices.begin(), neighborNodeIndices.end(),
+                      [&](const std::size_t nodeIndex) {
+                        return markingPolygonIndices.at(nodeIndex)
+                               == polygonIndex;
+                      })) {
+        affectedNeighborPolygonIndices.push_back(neighborPolygonIndex);
+      }
+    }
+    affectedNeighborOffsets.push_back(affectedNeighborPolygonIndices.size());
+  }
 }
 
 void GetmeSequential::applySmoothing() {
@@ -76,44 +169,69 @@ void GetmeSequential::applySmoothing() {
 
   double lastQMinStar = minHeap.getQMinStar();
   double bestQMinStarValue = lastQMinStar;
-  auto bestQMinStarNodes = mesh.getNodes();
+  bestQMinStarNodes = mesh.getNodes();
   std::size_t numberOfConsecutiveNoImproveCycles = 0;
 
+  // Single iterations are too short to be traced. Hence, each quality
+  // evaluation cycle is traced as a whole.
+  std::optional<Utility::ScopedTraceSpan> cycleTraceSpan;
+  const auto initialEventCounts = Utility::getEventCounts();
   Utility::StopWatch stopWatch;
   while (true) {
     ++iteration;
+    if constexpr (Utility::isTracingEnabled) {
+      if (!cycleTraceSpan) {
+        cycleTraceSpan.emplace(
+            "GETMe sequential cycle",
+            (iteration - 1) / config.qualityEvaluationCycleLength + 1);
+      }
+    }
     const std::size_t transformedPolygonIndex =
         minHeap.getLowestQualityPolygonIndex();
 
     if (lastTransformedPolygonIndex == transformedPolygonIndex) {
       minHeap.addToPenaltySum(transformedPolygonIndex, config.penaltyRepeated);
+      Utility::countEvent(Utility::Event::RepeatedSelection);
     }
 
     const auto& transformedPolygon = polygons.at(transformedPolygonIndex);
     transformPolygonAndSetTemporaryNodes(transformedPolygon);
+    const bool isRecordDue =
+        isConvergenceRecordDue(config.convergenceHistoryInterval, iteration);
+    double maxNodeRelocationDistance = 0.0;
+    std::size_t numberOfNodeResets = 0;
     if (const auto localQualityInfo =
             assessLocalQuality(transformedPolygonIndex);
         !localQualityInfo.areAllElementsValid) {
       // Reset temporary nodes.
       copyNodes(transformedPolygonIndex, mesh.getNodes(), temporaryNodes);
       minHeap.addToPenaltySum(transformedPolygonIndex, config.penaltyInvalid);
+      Utility::countEvent(Utility::Event::RejectedSequentialStep);
+      numberOfNodeResets = movedNodeIndices.size();
     } else {
-      // Set final nodes and update element qualities.
-      copyNodes(transformedPolygonIndex, temporaryNodes,
-                mesh.getMutableNodes());
-      minHeap.updateMeanRatioNumberAndAddToPenaltySum(
-          transformedPolygonIndex,
-          localQualityInfo.transformedElementMeanRatioNumber,
-          -config.penaltySuccess);
-      for (const auto& [polygonIndex, newMeanRatioNumber] :
-           localQualityInfo.neighborElementIndexAndMeanRatioNumber) {
-        minHeap.updateMeanRatioNumberIfNotFixedPolygon(polygonIndex,
-                                                       newMeanRatioNumber);
+      if (isRecordDue) {
+        maxNodeRelocationDistance = computeMaxMovedNodeRelocationDistance();
       }
+      acceptLocalQualityResult(transformedPolygonIndex, localQualityInfo);
     }
     lastTransformedPolygonIndex = transformedPolygonIndex;
+    if (isRecordDue) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 convergenceRecordingPhase);
+      const auto meshQuality = computeCurrentMeshQuality();
+      convergenceHistory.push_back(createConvergenceRecord(
+          iteration, mesh, polygonMeanRatioValues, meshQuality,
+          maxNodeRelocationDistance, numberOfNodeResets, stopWatch));
+    }
+    if (isQMinStarTargetCheckedEachIteration
+        && numberOfPolygonsBelowQMinStarTarget == 0) {
+      bestQMinStarNodes = mesh.getNodes();
+      break;
+    }
 
     if (iteration % config.qualityEvaluationCycleLength == 0) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 qualityEvaluationCyclePhase);
       const double qMinStar = minHeap.getQMinStar();
       if (qMinStar > bestQMinStarValue) {
         bestQMinStarValue = qMinStar;
@@ -122,49 +240,126 @@ void GetmeSequential::applySmoothing() {
       } else {
         ++numberOfConsecutiveNoImproveCycles;
       }
+      if (config.qualityTargets.isSet() && !isQMinStarTargetCheckedEachIteration
+          && areQualityTargetsReached()) {
+        bestQMinStarNodes = mesh.getNodes();
+        break;
+      }
+      cycleTraceSpan.reset();
     }
     if (iteration == config.maxIterations
         || numberOfConsecutiveNoImproveCycles
                == config.maxNoImprovementCycles) {
       break;
     }
+    if (isWallClockTimeExceeded(stopWatch, config.maxWallClockTimeInSeconds)
+        || isCancelledByObserver(
+            config.observer, "GETMe sequential", iteration, stopWatch,
+            [this]() { return computeCurrentMeshQuality(); })) {
+      // The current mesh might be better than the best mesh of the last
+      // quality evaluation.
+      if (minHeap.getQMinStar() > bestQMinStarValue) {
+        bestQMinStarNodes = mesh.getNodes();
+      }
+      break;
+    }
   }
+  cycleTraceSpan.reset();
   stopWatch.stop();
 
   // Set result data.
   mesh.getMutableNodes() = bestQMinStarNodes;
   iterationsApplied = iteration;
   smoothingTimeInSeconds = stopWatch.getElapsedTimeInSeconds();
+  eventCounts = Utility::getEventCounts() - initialEventCounts;
+}
+
+Mesh::MeshQuality GetmeSequential::computeCurrentMeshQuality() {
+  minHeap.getMeanRatioNumbers(polygonMeanRatioValues);
+  return Mesh::MeshQuality(polygonMeanRatioValues, false);
+}
+
+bool GetmeSequential::areQualityTargetsReached() {
+  const auto meshQuality = computeCurrentMeshQuality();
+  return Smoothing::areQualityTargetsReached(
+      config.qualityTargets, mesh, polygonMeanRatioValues, meshQuality);
+}
+
+void GetmeSequential::initNumberOfPolygonsBelowQMinStarTarget() {
+  minHeap.getMeanRatioNumbers(polygonMeanRatioValues);
+  numberOfPolygonsBelowQMinStarTarget = 0;
+  for (std::size_t polygonIndex = 0;
+       polygonIndex < polygonMeanRatioValues.size(); ++polygonIndex) {
+    if (!mesh.isFixedPolygon(polygonIndex)
+        && polygonMeanRatioValues.at(polygonIndex)
+               < *config.qualityTargets.qMinStar) {
+      ++numberOfPolygonsBelowQMinStarTarget;
+    }
+  }
+}
+
+void GetmeSequential::updateNumberOfPolygonsBelowQMinStarTarget(
+    const std::size_t polygonIndex,
+    const double newPolygonMeanRatioNumber) {
+  if (mesh.isFixedPolygon(polygonIndex)) {
+    return;
+  }
+  const double target = *config.qualityTargets.qMinStar;
+  const bool wasBelowTarget = minHeap.getMeanRatioNumber(polygonIndex) < target;
+  const bool isBelowTarget = newPolygonMeanRatioNumber < target;
+  if (wasBelowTarget && !isBelowTarget) {
+    --numberOfPolygonsBelowQMinStarTarget;
+  } else if (!wasBelowTarget && isBelowTarget) {
+    ++numberOfPolygonsBelowQMinStarTarget;
+  }
 }
 
 void GetmeSequential::transformPolygonAndSetTemporaryNodes(
     const Mathematics::Polygon& polygon) {
+  const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, transformationPhase);
   auto transformedNodes = transformScaleAndRelaxElement(
       config.polygonTransformations.at(polygon.getNumberOfNodes()),
       config.relaxationParameterRho, polygon, mesh.getNodes());
-  const auto& nodeIndices = polygon.getNodeIndices();
-  for (std::size_t nodeNumber = 0; nodeNumber < nodeIndices.size();
+  movedNodeIndices.clear();
+  for (std::size_t nodeNumber = 0; nodeNumber < polygon.getNumberOfNodes();
        ++nodeNumber) {
-    const std::size_t nodeIndex = nodeIndices.at(nodeNumber);
+    const std::size_t nodeIndex = polygon.getNodeIndex(nodeNumber);
     if (!isNodeFixed.at(nodeIndex)) {
       temporaryNodes.at(nodeIndex) = transformedNodes.at(nodeNumber);
+      movedNodeIndices.push_back(nodeIndex);
     }
   }
+  if (meanRatioCornerCache) {
+    meanRatioCornerCache->setMovedNodes(movedNodeIndices);
+  }
+}
+
+double GetmeSequential::computeMaxMovedNodeRelocationDistance() const {
+  double maxSquaredNodeRelocationDistance = 0.0;
+  for (const auto nodeIndex : movedNodeIndices) {
+    maxSquaredNodeRelocationDistance =
+        std::max(maxSquaredNodeRelocationDistance,
+                 (temporaryNodes.at(nodeIndex) - mesh.getNodes().at(nodeIndex))
+                     .getLengthSquared());
+  }
+  return std::sqrt(maxSquaredNodeRelocationDistance);
 }
 
 GetmeSequential::LocalQualityResult GetmeSequential::assessLocalQuality(
-    const std::size_t transformedPolygonIndex) const {
-  const auto& polygons = mesh.getPolygons();
+    const std::size_t transformedPolygonIndex) {
+  const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                             localQualityAssessmentPhase);
   LocalQualityResult result;
-  result.transformedElementMeanRatioNumber = Mathematics::getMeanRatio(
-      polygons.at(transformedPolygonIndex), temporaryNodes);
+  result.transformedElementMeanRatioNumber =
+      computeMeanRatioForTemporaryNodes(transformedPolygonIndex);
   if (result.transformedElementMeanRatioNumber <= 0.0) {
     return result;
   }
+  // Neighbors sharing only fixed nodes remain unchanged and are skipped.
   for (const auto neighborPolygonIndex :
-       mesh.getIndicesOfNeighborPolygons(transformedPolygonIndex)) {
-    const double neighborMeanRatioNumber = Mathematics::getMeanRatio(
-        polygons.at(neighborPolygonIndex), temporaryNodes);
+       getAffectedNeighborPolygonIndices(transformedPolygonIndex)) {
+    const double neighborMeanRatioNumber =
+        computeMeanRatioForTemporaryNodes(neighborPolygonIndex);
     // Preliminary termination if one neighbor was invalidated.
     if (neighborMeanRatioNumber <= 0.0) {
       return result;
@@ -176,6 +371,60 @@ GetmeSequential::LocalQualityResult GetmeSequential::assessLocalQuality(
   return result;
 }
 
+std::span<const std::size_t>
+GetmeSequential::getAffectedNeighborPolygonIndices(
+    const std::size_t polygonIndex) const {
+  const auto begin = affectedNeighborOffsets.at(polygonIndex);
+  const auto end = affectedNeighborOffsets.at(polygonIndex + 1);
+  return std::span<const std::size_t>(affectedNeighborPolygonIndices)
+      .subspan(begin, end - begin);
+}
+
+// If the corner cache is used, only the corners adjacent to the moved nodes of
+// the transformed polygon are recomputed. The resulting values are staged in
+// the cache.
+double GetmeSequential::computeMeanRatioForTemporaryNodes(
+    const std::size_t polygonIndex) {
+  if (meanRatioCornerCache) {
+    return meanRatioCornerCache->computeMeanRatioForMovedNodes(polygonIndex,
+                                                               temporaryNodes);
+  }
+  return Mathematics::getMeanRatio(mesh.getPolygons().at(polygonIndex),
+                                   temporaryNodes);
+}
+
+void GetmeSequential::acceptLocalQualityResult(
+    const std::size_t transformedPolygonIndex,
+    const LocalQualityResult& localQualityResult) {
+  const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, minHeapUpdatePhase);
+  // Set final nodes and update element qualities.
+  copyNodes(transformedPolygonIndex, temporaryNodes, mesh.getMutableNodes());
+  if (meanRatioCornerCache) {
+    meanRatioCornerCache->acceptStagedValues(transformedPolygonIndex);
+  }
+  if (isQMinStarTargetCheckedEachIteration) {
+    updateNumberOfPolygonsBelowQMinStarTarget(
+        transformedPolygonIndex,
+        localQualityResult.transformedElementMeanRatioNumber);
+  }
+  minHeap.updateMeanRatioNumberAndAddToPenaltySum(
+      transformedPolygonIndex,
+      localQualityResult.transformedElementMeanRatioNumber,
+      -config.penaltySuccess);
+  for (const auto& [polygonIndex, newMeanRatioNumber] :
+       localQualityResult.neighborElementIndexAndMeanRatioNumber) {
+    if (meanRatioCornerCache) {
+      meanRatioCornerCache->acceptStagedValues(polygonIndex);
+    }
+    if (isQMinStarTargetCheckedEachIteration) {
+      updateNumberOfPolygonsBelowQMinStarTarget(polygonIndex,
+                                                newMeanRatioNumber);
+    }
+    minHeap.updateMeanRatioNumberIfNotFixedPolygon(polygonIndex,
+                                                   newMeanRatioNumber);
+  }
+}
+
 void GetmeSequential::copyNodes(
     const std::size_t polygonIndex,
     const std::vector<Mathematics::Vector2D>& sourceNodes,
@@ -22,23 +22,73 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 // the GETMe book.
 #pragma once
 
+#include "Mesh/mean_ratio_corner_cache.h"
+#include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
+#include "Smoothing/convergence_history.h"
 #include "Smoothing/getme_sequential_config.h"
 #include "Smoothing/smoothing_result.h"
+#include "Smoothing/smoothing_workspace.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
 #include "polygon_quality_min_heap.h"
 
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
 namespace Smoothing {
+// Helper data of GETMe sequential kept in a smoothing workspace. Members keep
+// their capacity between smoothing calls and are reinitialized for each mesh.
+struct GetmeSequentialBuffers final {
+  PolygonQualityMinHeap minHeap;
+  std::vector<std::uint8_t> isNodeFixed;
+  std::vector<Mathematics::Vector2D> temporaryNodes;
+  std::vector<Mathematics::Vector2D> bestQMinStarNodes;
+  // Compressed storage of the neighbor polygons sharing at least one non fixed
+  // node with a polygon. Only these can change if the polygon is transformed.
+  // The neighbors of the polygon with index k are stored in the index range
+  // [affectedNeighborOffsets[k], affectedNeighborOffsets[k+1]).
+  std::vector<std::size_t> affectedNeighborOffsets;
+  std::vector<std::size_t> affectedNeighborPolygonIndices;
+  // Index of the last polygon, for which a node was marked as non fixed
+  // polygon node while collecting the affected neighbors.
+  std::vector<std::size_t> markingPolygonIndices;
+  // Indices of the non fixed nodes of the last transformed polygon.
+  std::vector<std::size_t> movedNodeIndices;
+  // Only used for meshes with polygons with many nodes. Might hold the cache
+  // of a previously smoothed mesh.
+  std::optional<Mesh::MeanRatioCornerCache> meanRatioCornerCache;
+  std::vector<double> polygonMeanRatioValues;
+
+  // Get the accumulated capacity of all buffers in bytes.
+  std::size_t getCapacityInBytes() const;
+};
+
 class GetmeSequential final {
 public:
   GetmeSequential(const Mesh::PolygonalMesh& mesh,
-                  const GetmeSequentialConfig& config);
+                  const GetmeSequentialConfig& config,
+                  SmoothingWorkspace& workspace);
 
   SmoothingResult getResult() const;
 
 private:
   void checkInputData() const;
   void initHelperData();
+  void initAffectedNeighborPolygonIndices();
   void applySmoothing();
+  // Compute the mesh quality based on the min heap polygon qualities.
+  Mesh::MeshQuality computeCurrentMeshQuality();
+  bool areQualityTargetsReached();
+  // Count the non fixed polygons below the q_min* target.
+  void initNumberOfPolygonsBelowQMinStarTarget();
+  // Update the count of polygons below the q_min* target before the quality of
+  // the given polygon is set to the given value.
+  void updateNumberOfPolygonsBelowQMinStarTarget(
+      const std::size_t polygonIndex,
+      const double newPolygonMeanRatioNumber);
 
   struct LocalQualityResult final {
     bool areAllElementsValid = false;
@@ -49,8 +99,16 @@ private:
 
   void transformPolygonAndSetTemporaryNodes(
       const Mathematics::Polygon& polygon);
+  // Maximal relocation distance of the moved nodes of the last transformed
+  // polygon, if its temporary nodes are accepted.
+  double computeMaxMovedNodeRelocationDistance() const;
   LocalQualityResult assessLocalQuality(
-      const std::size_t transformedPolygonIndex) const;
+      const std::size_t transformedPolygonIndex);
+  std::span<const std::size_t> getAffectedNeighborPolygonIndices(
+      const std::size_t polygonIndex) const;
+  double computeMeanRatioForTemporaryNodes(const std::size_t polygonIndex);
+  void acceptLocalQualityResult(const std::size_t transformedPolygonIndex,
+                                const LocalQualityResult& localQualityResult);
   void copyNodes(const std::size_t polygonIndex,
                  const std::vector<Mathematics::Vector2D>& sourceNodes,
                  std::vector<Mathematics::Vector2D>& targetNodes) const;
@@ -59,13 +117,39 @@ private:
   Mesh::PolygonalMesh mesh;
   const GetmeSequentialConfig& config;
 
-  // Helper data.
-  PolygonQualityMinHeap minHeap;
-  std::vector<bool> isNodeFixed;
-  std::vector<Mathematics::Vector2D> temporaryNodes;
+  // Helper data referring to the workspace buffers.
+  SmoothingWorkspace& workspace;
+  PolygonQualityMinHeap& minHeap;
+  std::vector<std::uint8_t>& isNodeFixed;
+  std::vector<Mathematics::Vector2D>& temporaryNodes;
+  std::vector<Mathematics::Vector2D>& bestQMinStarNodes;
+  std::vector<std::size_t>& affectedNeighborOffsets;
+  std::vector<std::size_t>& affectedNeighborPolygonIndices;
+  std::vector<std::size_t>& markingPolygonIndices;
+  std::vector<std::size_t>& movedNodeIndices;
+  // Points to the workspace cache, if it is used for the mesh.
+  Mesh::MeanRatioCornerCache* meanRatioCornerCache = nullptr;
+  // Polygon qualities ordered by polygon index, e.g. for quality evaluations.
+  std::vector<double>& polygonMeanRatioValues;
+  // If q_min* is the only quality target, it is checked after each iteration
+  // by counting the non fixed polygons below the target. Since only the
+  // polygons changed by a step have to be considered, no pass over all
+  // polygons is required.
+  bool isQMinStarTargetCheckedEachIteration = false;
+  std::size_t numberOfPolygonsBelowQMinStarTarget = 0;
 
   // Result data.
   double smoothingTimeInSeconds = 0.0;
   std::size_t iterationsApplied = 0;
+  ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
+  // Phases timed in each single polygon step. Slots avoid searching the phases
+  // by name in each step.
+  Utility::PhaseSlot transformationPhase{"transformation"};
+  Utility::PhaseSlot localQualityAssessmentPhase{"local quality assessment"};
+  Utility::PhaseSlot minHeapUpdatePhase{"min heap update"};
+  Utility::PhaseSlot convergenceRecordingPhase{"convergence recording"};
+  Utility::PhaseSlot qualityEvaluationCyclePhase{"quality evaluation cycle"};
+  Utility::EventCounts eventCounts;
 };
 }  // namespace Smoothing
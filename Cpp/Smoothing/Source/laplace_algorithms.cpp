@@ -21,31 +21,43 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #include "Smoothing/laplace_algorithms.h"
 
+#include "Mathematics/node_coordinate_arrays.h"
 #include "Mathematics/vector2d.h"
+#include "Mesh/mean_ratio_corner_cache.h"
 #include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
 #include "Smoothing/basic_laplace_config.h"
+#include "Smoothing/convergence_history.h"
 #include "Smoothing/smart_laplace_config.h"
 #include "Smoothing/smoothing_result.h"
+#include "Smoothing/smoothing_workspace.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
+#include "Utility/memory_usage.h"
+#include "Utility/phase_timer.h"
 #include "Utility/stop_watch.h"
+#include "Utility/tracing.h"
 #include "common_algorithms.h"
 
 #include <algorithm>
 #include <cmath>
 #include <execution>
+#include <optional>
+#include <utility>
 
 namespace {
+// Compute the Laplace average for interleaved or structure of arrays nodes.
+template <typename Nodes>
 Mathematics::Vector2D computeArithmeticMeanOfEdgeConnectedNodes(
     const Mesh::PolygonalMesh& mesh,
+    const Nodes& currentNodes,
     const std::size_t nodeIndex) {
   Mathematics::Vector2D newNodePosition(0.0, 0.0);
-  const auto& currentNodes = mesh.getNodes();
   const auto& indicesOfEdgeConnectedNodes =
       mesh.getIndicesOfEdgeConnectedNodes(nodeIndex);
   for (const auto connectedNodeIndex : indicesOfEdgeConnectedNodes) {
-    newNodePosition += currentNodes.at(connectedNodeIndex);
+    newNodePosition += Mathematics::getNode(currentNodes, connectedNodeIndex);
   }
   newNodePosition /= static_cast<double>(indicesOfEdgeConnectedNodes.size());
   return newNodePosition;
@@ -55,44 +67,148 @@ Mathematics::Vector2D computeArithmeticMeanOfEdgeConnectedNodes(
 Smoothing::SmoothingResult Smoothing::basicLaplace(
     Mesh::PolygonalMesh mesh,
     const BasicLaplaceConfig& config) {
+  SmoothingWorkspace workspace;
+  return basicLaplace(std::move(mesh), config, workspace);
+}
+
+Smoothing::SmoothingResult Smoothing::basicLaplace(
+    Mesh::PolygonalMesh mesh,
+    const BasicLaplaceConfig& config,
+    SmoothingWorkspace& workspace) {
+  checkActiveSetRelocationDistanceFraction(
+      config.activeSetRelocationDistanceFraction);
+  checkMomentumFactor(config.momentumFactor);
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  checkObserver(config.observer);
   std::size_t iteration = 0;
+  // Laplace averaging only streams node coordinates. Hence, structure of
+  // arrays node storage is used. Since fixed nodes are never changed and all
+  // non fixed nodes are updated in each iteration, both node arrays can be
+  // swapped after each iteration. Before being overwritten, the new node
+  // arrays hold the node positions of the previous iteration, which are used
+  // for momentum acceleration.
+  auto& currentNodes = workspace.getCurrentNodeArrays();
+  auto& newNodes = workspace.getNewNodeArrays();
+  currentNodes.assign(mesh.getNodes());
+  newNodes.assign(mesh.getNodes());
+  // In active set mode, only active nodes are updated. Nodes moving farther
+  // than the freezing distance keep themselves and their edge connected nodes
+  // active.
+  const bool useActiveSet = config.activeSetRelocationDistanceFraction > 0.0;
+  const double squaredFreezingDistance =
+      config.activeSetRelocationDistanceFraction
+      * config.activeSetRelocationDistanceFraction
+      * config.maxSquaredNodeRelocationDistanceThreshold;
+  auto& activeSet = workspace.getActiveSetBuffers();
+  if (useActiveSet) {
+    initializeActiveSet(mesh, activeSet);
+  }
+  ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
 
+  const auto initialEventCounts = Utility::getEventCounts();
   Utility::StopWatch stopWatch;
   while (true) {
     ++iteration;
+    const Utility::ScopedTraceSpan traceSpan("Basic Laplace iteration",
+                                             iteration);
     double maxSquaredNodeRelocationDistance = 0.0;
-    auto newNodePositions = mesh.getNodes();
-    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
-      const auto newNodePosition =
-          computeArithmeticMeanOfEdgeConnectedNodes(mesh, nodeIndex);
-      newNodePositions.at(nodeIndex) = newNodePosition;
-      updateMaxSquaredNodeRelocationDistance(mesh.getNodes().at(nodeIndex),
-                                             newNodePosition,
-                                             maxSquaredNodeRelocationDistance);
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "node relocation");
+      for (const auto nodeIndex : useActiveSet
+                                      ? activeSet.activeNodeIndices
+                                      : mesh.getNonFixedNodeIndices()) {
+        auto newNodePosition = computeArithmeticMeanOfEdgeConnectedNodes(
+            mesh, currentNodes, nodeIndex);
+        if (config.momentumFactor > 0.0) {
+          newNodePosition = addMomentum(newNodePosition,
+                                        currentNodes.getNode(nodeIndex),
+                                        newNodes.getNode(nodeIndex),
+                                        config.momentumFactor);
+        }
+        newNodes.setNode(nodeIndex, newNodePosition);
+        const double squaredNodeRelocationDistance =
+            (newNodePosition - currentNodes.getNode(nodeIndex))
+                .getLengthSquared();
+        maxSquaredNodeRelocationDistance = std::max(
+            maxSquaredNodeRelocationDistance, squaredNodeRelocationDistance);
+        if (useActiveSet
+            && squaredNodeRelocationDistance > squaredFreezingDistance) {
+          activateNodeInNextIteration(nodeIndex, activeSet);
+          for (const auto connectedNodeIndex :
+               mesh.getIndicesOfEdgeConnectedNodes(nodeIndex)) {
+            activateNodeInNextIteration(connectedNodeIndex, activeSet);
+          }
+        }
+      }
     }
-    mesh.setNodes(newNodePositions);
+    std::swap(currentNodes, newNodes);
+    if (isConvergenceRecordDue(config.convergenceHistoryInterval, iteration)) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "convergence recording");
+      convergenceHistory.push_back(createConvergenceRecord(
+          iteration, mesh, currentNodes.toVector2DNodes(),
+          std::sqrt(maxSquaredNodeRelocationDistance), stopWatch));
+    }
+    // In active set mode, frozen nodes may still move farther than the
+    // threshold. Hence, convergence of the active nodes is confirmed by an
+    // iteration over all non fixed nodes.
+    const bool isConverged = maxSquaredNodeRelocationDistance
+                             <= config.maxSquaredNodeRelocationDistanceThreshold;
     if (iteration == config.maxIterations
-        || maxSquaredNodeRelocationDistance
-               <= config.maxSquaredNodeRelocationDistanceThreshold) {
+        || (isConverged
+            && (!useActiveSet || containsAllNonFixedNodes(mesh, activeSet)))
+        || isWallClockTimeExceeded(stopWatch,
+                                   config.maxWallClockTimeInSeconds)
+        || isCancelledByObserver(
+            config.observer, "Basic Laplace", iteration, stopWatch, [&]() {
+              return computeMeshQuality(mesh, currentNodes.toVector2DNodes());
+            })) {
       break;
     }
+    if (useActiveSet) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "active set update");
+      if (isConverged) {
+        activateAllNonFixedNodesInNextIteration(mesh, activeSet);
+      }
+      // Nodes frozen from now on have to keep their position in both arrays.
+      for (const auto nodeIndex : activeSet.activeNodeIndices) {
+        if (!activeSet.isNextActiveNode[nodeIndex]) {
+          newNodes.setNode(nodeIndex, currentNodes.getNode(nodeIndex));
+        }
+      }
+      advanceActiveSet(activeSet);
+    }
   }
   stopWatch.stop();
+  currentNodes.copyTo(mesh.getMutableNodes());
 
   return SmoothingResult("Basic Laplace", mesh,
-                         stopWatch.getElapsedTimeInSeconds(), iteration);
+                         stopWatch.getElapsedTimeInSeconds(), iteration,
+                         std::move(convergenceHistory), std::move(phaseTimes),
+                         Utility::getEventCounts() - initialEventCounts,
+                         workspace.getCapacityInBytes());
 }
 
 namespace {
+// If given, the corner cache holds the values of the current mesh nodes. Since
+// only a single node is moved, only its adjacent corners are recomputed.
 void updateNodePositionIfQualityIsImproved(
     const Mesh::PolygonalMesh& mesh,
     const std::vector<double>& polygonMeanRatioValuesForMesh,
     const std::size_t nodeIndexToUpdate,
+    std::optional<Mesh::MeanRatioCornerCache>& meanRatioCornerCache,
     std::vector<Mathematics::Vector2D>& temporaryNewNodePositions,
     std::vector<Mathematics::Vector2D>& finalNewNodePositions) {
-  const auto newNodePosition =
-      computeArithmeticMeanOfEdgeConnectedNodes(mesh, nodeIndexToUpdate);
+  const auto newNodePosition = computeArithmeticMeanOfEdgeConnectedNodes(
+      mesh, mesh.getNodes(), nodeIndexToUpdate);
   temporaryNewNodePositions.at(nodeIndexToUpdate) = newNodePosition;
+  if (meanRatioCornerCache) {
+    const std::size_t movedNodeIndices[] = {nodeIndexToUpdate};
+    meanRatioCornerCache->setMovedNodes(movedNodeIndices);
+  }
 
   double oldAttachedPolygonsMeanRatioSum = 0.0;
   double newAttachedPolygonsMeanRatioSum = 0.0;
@@ -100,8 +216,13 @@ void updateNodePositionIfQualityIsImproved(
        mesh.getAttachedPolygonIndices(nodeIndexToUpdate)) {
     oldAttachedPolygonsMeanRatioSum +=
         polygonMeanRatioValuesForMesh.at(attachedPolygonIndex);
-    const double newPolygonMeanRatioValue = Mathematics::getMeanRatio(
-        mesh.getPolygons().at(attachedPolygonIndex), temporaryNewNodePositions);
+    const double newPolygonMeanRatioValue =
+        meanRatioCornerCache
+            ? meanRatioCornerCache->computeMeanRatioForMovedNodes(
+                attachedPolygonIndex, temporaryNewNodePositions)
+            : Mathematics::getMeanRatio(
+                mesh.getPolygons().at(attachedPolygonIndex),
+                temporaryNewNodePositions);
     if (newPolygonMeanRatioValue <= 0.0) {
       // Preliminary return if a polygon is invalidated;
       return;
@@ -112,37 +233,98 @@ void updateNodePositionIfQualityIsImproved(
     finalNewNodePositions.at(nodeIndexToUpdate) = newNodePosition;
   }
 }
+
+// Update the corner cache for the nodes changed by the last iteration.
+void updateMeanRatioCornerCache(
+    const Mesh::PolygonalMesh& mesh,
+    const std::vector<Mathematics::Vector2D>& oldNodePositions,
+    const std::vector<Mathematics::Vector2D>& newNodePositions,
+    std::vector<std::size_t>& movedNodeIndices,
+    Mesh::MeanRatioCornerCache& meanRatioCornerCache) {
+  movedNodeIndices.clear();
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    if (newNodePositions.at(nodeIndex) != oldNodePositions.at(nodeIndex)) {
+      movedNodeIndices.push_back(nodeIndex);
+    }
+  }
+  meanRatioCornerCache.setMovedNodes(movedNodeIndices);
+  meanRatioCornerCache.updateForMovedNodes(newNodePositions);
+}
 }  // namespace
 
 Smoothing::SmoothingResult Smoothing::smartLaplace(
     Mesh::PolygonalMesh mesh,
     const SmartLaplaceConfig& config) {
+  SmoothingWorkspace workspace;
+  return smartLaplace(std::move(mesh), config, workspace);
+}
+
+Smoothing::SmoothingResult Smoothing::smartLaplace(
+    Mesh::PolygonalMesh mesh,
+    const SmartLaplaceConfig& config,
+    SmoothingWorkspace& workspace) {
+  checkMaxWallClockTime(config.maxWallClockTimeInSeconds);
+  checkObserver(config.observer);
   std::size_t iteration = 0;
-  auto polygonMeanRatioValues = Mesh::computeMeanRatioQualityNumberOfPolygons(
-      mesh.getPolygons(), mesh.getNodes());
+  auto& buffers = workspace.getBuffers<double>();
+  auto& polygonMeanRatioValues = buffers.polygonMeanRatioValues;
+  polygonMeanRatioValues.resize(mesh.getNumberOfPolygons());
+  Mesh::computeMeanRatioQualityNumberOfPolygons(
+      mesh.getPolygons(), mesh.getNodes(), polygonMeanRatioValues);
   auto oldMeshQuality = Mesh::MeshQuality(polygonMeanRatioValues, false);
   Utility::throwExceptionIfFalse(
       oldMeshQuality.isValidMesh(),
       "Smart Laplace can only be applied to valid initial meshes.");
-  auto newNodePositions = mesh.getNodes();
-  auto temporaryNodePositions = mesh.getNodes();
+  auto& newNodePositions = buffers.newNodePositions;
+  auto& temporaryNodePositions = buffers.temporaryNodePositions;
+  newNodePositions = mesh.getNodes();
+  temporaryNodePositions = mesh.getNodes();
   // Data to be able to revert to mesh with best qMean at the end of smoothing.
   double bestQMeanValue = oldMeshQuality.getQMean();
-  auto bestQMeanNodes = mesh.getNodes();
+  auto& bestQMeanNodes = buffers.bestQMeanNodes;
+  bestQMeanNodes = mesh.getNodes();
+  // Caching corner summands only pays off for polygons with many nodes.
+  std::optional<Mesh::MeanRatioCornerCache> meanRatioCornerCache;
+  if (Mesh::MeanRatioCornerCache::isBeneficialFor(mesh)) {
+    meanRatioCornerCache.emplace(mesh);
+  }
+  std::vector<std::size_t> movedNodeIndices;
+  ConvergenceHistory convergenceHistory;
+  Utility::PhaseTimes phaseTimes;
 
+  const auto initialEventCounts = Utility::getEventCounts();
   Utility::StopWatch stopWatch;
   while (true) {
     ++iteration;
-    for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
-      updateNodePositionIfQualityIsImproved(mesh, polygonMeanRatioValues,
-                                            nodeIndex, temporaryNodePositions,
-                                            newNodePositions);
-      temporaryNodePositions.at(nodeIndex) = mesh.getNodes().at(nodeIndex);
+    const Utility::ScopedTraceSpan traceSpan("Smart Laplace iteration",
+                                             iteration);
+    {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "node relocation");
+      for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+        updateNodePositionIfQualityIsImproved(
+            mesh, polygonMeanRatioValues, nodeIndex, meanRatioCornerCache,
+            temporaryNodePositions, newNodePositions);
+        temporaryNodePositions.at(nodeIndex) = mesh.getNodes().at(nodeIndex);
+      }
+    }
+    const auto newMeshQuality = iterativelyResetNodesResultingInInvalidElements(
+        newNodePositions, mesh.getNodes(), polygonMeanRatioValues, mesh,
+        workspace.getInvalidElementResetBuffers(), phaseTimes);
+    if (isConvergenceRecordDue(config.convergenceHistoryInterval, iteration)) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "convergence recording");
+      convergenceHistory.push_back(createConvergenceRecord(
+          iteration, mesh, polygonMeanRatioValues, newMeshQuality,
+          computeMaxNodeRelocationDistance(mesh, newNodePositions,
+                                           mesh.getNodes()),
+          workspace.getInvalidElementResetBuffers().indicesOfResetNodes.size(),
+          stopWatch));
     }
-    const auto newMeshQuality =
-        iterativelyResetNodesResultingInInvalidElementsSetNewMeshNodesAndUpdateElementQualityNumbers(
-            newNodePositions, polygonMeanRatioValues, mesh);
+    mesh.setNodes(newNodePositions);
     if (bestQMeanValue < newMeshQuality.getQMean()) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "best mesh copying");
       bestQMeanValue = newMeshQuality.getQMean();
       bestQMeanNodes = mesh.getNodes();
     }
@@ -150,16 +332,36 @@ Smoothing::SmoothingResult Smoothing::smartLaplace(
     if (const double qMeanImprovement =
             newMeshQuality.getQMean() - oldMeshQuality.getQMean();
         iteration == config.maxIterations
-        || qMeanImprovement <= config.qMeanImprovementThreshold) {
+        || qMeanImprovement <= config.qMeanImprovementThreshold
+        || isWallClockTimeExceeded(stopWatch,
+                                   config.maxWallClockTimeInSeconds)
+        || isCancelledByObserver(config.observer, "Smart Laplace", iteration,
+                                 stopWatch,
+                                 [&]() { return newMeshQuality; })) {
       break;
     }
     oldMeshQuality = newMeshQuality;
-    newNodePositions = mesh.getNodes();
+    if (meanRatioCornerCache) {
+      const Utility::ScopedPhaseTimer phaseTimer(phaseTimes,
+                                                 "corner cache update");
+      // Temporary node positions still match the previous mesh nodes.
+      updateMeanRatioCornerCache(mesh, temporaryNodePositions, newNodePositions,
+                                 movedNodeIndices, *meanRatioCornerCache);
+    }
+    // New node positions already match the updated mesh nodes.
     temporaryNodePositions = mesh.getNodes();
   }
   stopWatch.stop();
   // Revert to mesh with best qMean value.
   mesh.getMutableNodes() = bestQMeanNodes;
+  const auto scratchMemoryInBytes =
+      workspace.getCapacityInBytes()
+      + Utility::getMemoryUsage(movedNodeIndices).bytes
+      + (meanRatioCornerCache ? meanRatioCornerCache->getCapacityInBytes()
+                              : 0);
   return SmoothingResult("Smart Laplace", mesh,
-                         stopWatch.getElapsedTimeInSeconds(), iteration);
+                         stopWatch.getElapsedTimeInSeconds(), iteration,
+                         std::move(convergenceHistory), std::move(phaseTimes),
+                         Utility::getEventCounts() - initialEventCounts,
+                         scratchMemoryInBytes);
 }
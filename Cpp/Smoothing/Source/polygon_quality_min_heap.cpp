@@ -24,22 +24,33 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
+#include "Utility/event_counters.h"
 #include "Utility/exception_handling.h"
 
 #include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace Smoothing {
-PolygonQualityMinHeap::PolygonQualityMinHeap(const Mesh::PolygonalMesh& mesh)
-  : polygonIndexToBinaryTreeEntryIndex(
-      mesh.getNumberOfPolygons(),
-      std::numeric_limits<std::size_t>::max()) {
-  binaryTree.reserve(mesh.getNumberOfPolygons());
-
-  const auto meanRatioQualityNumbers =
-      Mesh::computeMeanRatioQualityNumberOfPolygons(mesh.getPolygons(),
-                                                    mesh.getNodes());
-  for (std::size_t polygonIndex = 0; polygonIndex < mesh.getNumberOfPolygons();
+PolygonQualityMinHeap::PolygonQualityMinHeap(const Mesh::PolygonalMesh& mesh) {
+  std::vector<double> meanRatioQualityNumbers;
+  init(mesh, meanRatioQualityNumbers);
+}
+
+void PolygonQualityMinHeap::init(
+    const Mesh::PolygonalMesh& mesh,
+    std::vector<double>& meanRatioQualityNumbers) {
+  const auto numberOfPolygons = mesh.getNumberOfPolygons();
+  polygonIndexToBinaryTreeEntryIndex.assign(
+      numberOfPolygons, std::numeric_limits<std::size_t>::max());
+  binaryTree.clear();
+  binaryTree.reserve(numberOfPolygons);
+
+  meanRatioQualityNumbers.resize(numberOfPolygons);
+  Mesh::computeMeanRatioQualityNumberOfPolygons(
+      mesh.getPolygons(), mesh.getNodes(), meanRatioQualityNumbers);
+  for (std::size_t polygonIndex = 0; polygonIndex < numberOfPolygons;
        ++polygonIndex) {
     binaryTree.emplace_back(polygonIndex,
                             meanRatioQualityNumbers.at(polygonIndex),
@@ -58,6 +69,7 @@ inline bool PolygonQualityMinHeap::isFirstQualityLower(
 void PolygonQualityMinHeap::swapMinHeapEntriesAndAdjustMapping(
     const std::size_t firstEntryIndex,
     const std::size_t secondEntryIndex) {
+  Utility::countEvent(Utility::Event::HeapSiftStep);
   std::swap(binaryTree.at(firstEntryIndex), binaryTree.at(secondEntryIndex));
   polygonIndexToBinaryTreeEntryIndex.at(
       binaryTree.at(firstEntryIndex).getPolygonIndex()) = firstEntryIndex;
@@ -135,6 +147,14 @@ double PolygonQualityMinHeap::getQMinStar() const {
   return qMinStar;
 }
 
+void PolygonQualityMinHeap::getMeanRatioNumbers(
+    std::vector<double>& meanRatioNumbers) const {
+  meanRatioNumbers.resize(binaryTree.size());
+  for (const auto& entry : binaryTree) {
+    meanRatioNumbers.at(entry.getPolygonIndex()) = entry.getMeanRatioNumber();
+  }
+}
+
 bool PolygonQualityMinHeap::containsAnInvalidPolygon() const {
   const auto isInvalidPolygonPredicate = [](const MinHeapEntry& entry) {
     return entry.getMeanRatioNumber() < 0.0;
@@ -23,6 +23,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "Utility/exception_handling.h"
+#include "Utility/memory_usage.h"
 
 #include <compare>
 #include <cstddef>
@@ -105,12 +106,24 @@ private:
 // also kept in sync.
 class PolygonQualityMinHeap final {
 public:
+  PolygonQualityMinHeap() = default;
+
   explicit PolygonQualityMinHeap(const Mesh::PolygonalMesh& mesh);
 
+  // Rebuild the heap for the given mesh reusing the allocated storage. The
+  // given vector is set to the polygon mean ratio numbers.
+  void init(const Mesh::PolygonalMesh& mesh,
+            std::vector<double>& meanRatioQualityNumbers);
+
   std::size_t getLowestQualityPolygonIndex() const {
     return binaryTree.front().getPolygonIndex();
   }
 
+  double getMeanRatioNumber(const std::size_t polygonIndex) const {
+    return binaryTree.at(polygonIndexToBinaryTreeEntryIndex.at(polygonIndex))
+        .getMeanRatioNumber();
+  }
+
   void updateMeanRatioNumberIfNotFixedPolygon(
       const std::size_t polygonIndex,
       const double newPolygonMeanRatioNumber) {
@@ -153,8 +166,18 @@ public:
   // Return the lowest improvable polygon quality number.
   double getQMinStar() const;
 
+  // Set the given vector to the polygon mean ratio numbers ordered by polygon
+  // index.
+  void getMeanRatioNumbers(std::vector<double>& meanRatioNumbers) const;
+
   bool containsAnInvalidPolygon() const;
 
+  // Get the accumulated capacity of the heap and its lookup table in bytes.
+  std::size_t getCapacityInBytes() const {
+    return Utility::getMemoryUsage(binaryTree).bytes
+           + Utility::getMemoryUsage(polygonIndexToBinaryTreeEntryIndex).bytes;
+  }
+
 private:
   bool isPolygonIndexToBinaryTreeEntryIndexConsistent() const;
   bool isBinaryTreeConsistent() const;
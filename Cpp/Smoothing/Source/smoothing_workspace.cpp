@@ -0,0 +1,118 @@
+/*
+Reusable scratch buffers of the smoothing algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Smoothing/smoothing_workspace.h"
+
+#include "Utility/memory_usage.h"
+#include "getme_sequential.h"
+
+namespace {
+template <typename Scalar>
+Utility::MemoryUsage getMemoryUsage(
+    const Smoothing::SmoothingBuffers<Scalar>& buffers) {
+  return Utility::getMemoryUsage(buffers.nodes)
+         + Utility::getMemoryUsage(buffers.newNodePositions)
+         + Utility::getMemoryUsage(buffers.temporaryNodePositions)
+         + Utility::getMemoryUsage(buffers.bestQMeanNodes)
+         + Utility::getMemoryUsage(buffers.previousNodes)
+         + Utility::getMemoryUsage(buffers.transformedNodeSums)
+         + Utility::getMemoryUsage(buffers.nodeWeightSums)
+         + Utility::getMemoryUsage(buffers.polygonMeanRatioValues);
+}
+
+Utility::MemoryUsage getMemoryUsage(
+    const Smoothing::InvalidElementResetBuffers& buffers) {
+  return Utility::getMemoryUsage(buffers.isNodeToReset)
+         + Utility::getMemoryUsage(buffers.isNodeReset)
+         + Utility::getMemoryUsage(buffers.isAffectedPolygon)
+         + Utility::getMemoryUsage(buffers.indicesOfNodesToReset)
+         + Utility::getMemoryUsage(buffers.indicesOfAffectedPolygons)
+         + Utility::getMemoryUsage(buffers.indicesOfResetNodes);
+}
+
+Utility::MemoryUsage getMemoryUsage(
+    const Smoothing::ActiveSetBuffers& buffers) {
+  return Utility::getMemoryUsage(buffers.isNextActiveNode)
+         + Utility::getMemoryUsage(buffers.isActivePolygon)
+         + Utility::getMemoryUsage(buffers.activeNodeIndices)
+         + Utility::getMemoryUsage(buffers.nextActiveNodeIndices);
+}
+
+Utility::MemoryUsage getMemoryUsage(
+    const Mathematics::NodeCoordinateArrays& nodeArrays) {
+  return Utility::getMemoryUsage(nodeArrays.getXCoordinates())
+         + Utility::getMemoryUsage(nodeArrays.getYCoordinates());
+}
+}  // namespace
+
+namespace Smoothing {
+SmoothingWorkspace::SmoothingWorkspace() = default;
+
+SmoothingWorkspace::SmoothingWorkspace(const std::size_t numberOfNodes,
+                                       const std::size_t numberOfPolygons) {
+  reserve(numberOfNodes, numberOfPolygons);
+}
+
+SmoothingWorkspace::~SmoothingWorkspace() = default;
+
+SmoothingWorkspace::SmoothingWorkspace(SmoothingWorkspace&&) noexcept =
+    default;
+
+SmoothingWorkspace& SmoothingWorkspace::operator=(
+    SmoothingWorkspace&&) noexcept = default;
+
+void SmoothingWorkspace::reserve(const std::size_t numberOfNodes,
+                                 const std::size_t numberOfPolygons) {
+  auto& buffers = doublePrecisionBuffers;
+  buffers.newNodePositions.reserve(numberOfNodes);
+  buffers.temporaryNodePositions.reserve(numberOfNodes);
+  buffers.bestQMeanNodes.reserve(numberOfNodes);
+  buffers.transformedNodeSums.reserve(numberOfNodes);
+  buffers.nodeWeightSums.reserve(numberOfNodes);
+  buffers.polygonMeanRatioValues.reserve(numberOfPolygons);
+  invalidElementResetBuffers.isNodeToReset.reserve(numberOfNodes);
+  invalidElementResetBuffers.isNodeReset.reserve(numberOfNodes);
+  invalidElementResetBuffers.isAffectedPolygon.reserve(numberOfPolygons);
+  currentNodeArrays.getMutableXCoordinates().reserve(numberOfNodes);
+  currentNodeArrays.getMutableYCoordinates().reserve(numberOfNodes);
+  newNodeArrays.getMutableXCoordinates().reserve(numberOfNodes);
+  newNodeArrays.getMutableYCoordinates().reserve(numberOfNodes);
+}
+
+GetmeSequentialBuffers& SmoothingWorkspace::getGetmeSequentialBuffers() {
+  if (!getmeSequentialBuffers) {
+    getmeSequentialBuffers = std::make_unique<GetmeSequentialBuffers>();
+  }
+  return *getmeSequentialBuffers;
+}
+
+std::size_t SmoothingWorkspace::getCapacityInBytes() const {
+  const auto memoryUsage =
+      ::getMemoryUsage(doublePrecisionBuffers)
+      + ::getMemoryUsage(singlePrecisionBuffers)
+      + ::getMemoryUsage(invalidElementResetBuffers)
+      + ::getMemoryUsage(activeSetBuffers) + ::getMemoryUsage(currentNodeArrays)
+      + ::getMemoryUsage(newNodeArrays);
+  return memoryUsage.bytes
+         + (getmeSequentialBuffers ? getmeSequentialBuffers->getCapacityInBytes()
+                                   : 0);
+}
+}  // namespace Smoothing
@@ -28,11 +28,15 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
+#include "Testdata/mesh_generators.h"
 #include "Testdata/meshes.h"
+#include "Utility/phase_timer.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <numbers>
+#include <vector>
 
 TEST(CommonAlgorithms, applyEdgeLengthScaling) {
   const Mathematics::Polygon polygon({0, 1, 2, 3, 4, 5});
@@ -162,6 +166,38 @@ TEST(
   EXPECT_EQ(expectedMesh.getNodes(), newNodePositions);
 }
 
+TEST(CommonAlgorithms,
+     iterativelyResetNodesResultingInInvalidElements_resetNodesOnce) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 20;
+  config.numberOfCellsY = 20;
+  const auto mesh =
+      Testdata::generateGridMesh(config, Testdata::GridElementType::Triangle);
+  // Large distortions invalidate many elements, whose resets invalidate
+  // further elements in later rounds.
+  const double maxDistortionRadius = 0.9;
+  auto newNodePositions =
+      Mesh::distortNodesLocally(mesh, maxDistortionRadius, 1).getNodes();
+  std::vector<double> polygonMeanRatioValues(mesh.getNumberOfPolygons());
+  Smoothing::InvalidElementResetBuffers buffers;
+  Utility::PhaseTimes phaseTimes;
+
+  const auto meshQuality =
+      Smoothing::iterativelyResetNodesResultingInInvalidElements(
+          newNodePositions, mesh.getNodes(), polygonMeanRatioValues, mesh,
+          buffers, phaseTimes);
+
+  EXPECT_TRUE(meshQuality.isValidMesh());
+  auto resetNodeIndices = buffers.indicesOfResetNodes;
+  ASSERT_FALSE(resetNodeIndices.empty());
+  std::sort(resetNodeIndices.begin(), resetNodeIndices.end());
+  EXPECT_EQ(resetNodeIndices.end(), std::adjacent_find(resetNodeIndices.begin(),
+                                                       resetNodeIndices.end()));
+  for (const auto nodeIndex : resetNodeIndices) {
+    EXPECT_FALSE(mesh.getFixedNodeIndices().contains(nodeIndex));
+  }
+}
+
 TEST(CommonAlgorithms, checkTransformations_validTransformations) {
   const auto maxNumberOfPolygonNodes = 5;
   std::vector<Mathematics::GeneralizedPolygonTransformation> transformations;
@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Smoothing/getme_algorithms.h"
 
 #include "Mathematics/generalized_polygon_transformation.h"
+#include "Mesh/mesh_quality.h"
 #include "Mesh/polygonal_mesh.h"
 #include "Mesh/polygonal_mesh_algorithms.h"
 #include "Smoothing/basic_getme_simultaneous_config.h"
@@ -31,13 +32,23 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Smoothing/getme_sequential_config.h"
 #include "Smoothing/getme_simultaneous_config.h"
 #include "Smoothing/laplace_algorithms.h"
+#include "Smoothing/multilevel_getme_config.h"
+#include "Smoothing/multilevel_getme_result.h"
+#include "Smoothing/smoothing_observer.h"
 #include "Smoothing/smoothing_result.h"
+#include "Smoothing/smoothing_workspace.h"
+#include "Testdata/mesh_generators.h"
 #include "Testdata/meshes.h"
+#include "Utility/event_counters.h"
+#include "Utility/phase_timer.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <string_view>
+#include <vector>
 
 namespace {
 Mathematics::GeneralizedPolygonTransformation
@@ -46,6 +57,40 @@ getNonRegularizingPentagonTransformation() {
   const double theta = 0.99 * std::numbers::pi / 2.0;
   return Mathematics::GeneralizedPolygonTransformation(lambda, theta);
 }
+
+// Get a valid quadrilateral grid mesh, whose non fixed nodes are concentrated
+// near the left boundary. Smoothing moves these nodes over long distances.
+Mesh::PolygonalMesh getGradedGridMesh() {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 10;
+  config.numberOfCellsY = 10;
+  auto mesh = Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral);
+  const auto width = static_cast<double>(config.numberOfCellsX);
+  for (const auto nodeIndex : mesh.getNonFixedNodeIndices()) {
+    auto& node = mesh.getMutableNodes().at(nodeIndex);
+    node = Mathematics::Vector2D(width * std::pow(node.getX() / width, 3.0),
+                                 node.getY());
+  }
+  return mesh;
+}
+
+// Get the nodes of the second iteration with momentum, i.e. the nodes of the
+// second iteration without momentum plus the momentum term of the first
+// iteration, which equals plain smoothing.
+std::vector<Mathematics::Vector2D> getSecondMomentumIterationNodes(
+    const Mesh::PolygonalMesh& initialMesh,
+    const Mesh::PolygonalMesh& firstIterationMesh,
+    const Mesh::PolygonalMesh& secondIterationMesh,
+    const double momentumFactor) {
+  auto nodes = secondIterationMesh.getNodes();
+  for (const auto nodeIndex : initialMesh.getNonFixedNodeIndices()) {
+    nodes.at(nodeIndex) += momentumFactor
+                           * (firstIterationMesh.getNodes().at(nodeIndex)
+                              - initialMesh.getNodes().at(nodeIndex));
+  }
+  return nodes;
+}
 }  // namespace
 
 TEST(GetmeAlgorithms,
@@ -106,6 +151,133 @@ TEST(GetmeAlgorithms, basicGetmeSimultaneous_maxRelocationTerminated) {
                              nodeTolerance));
 }
 
+TEST(GetmeAlgorithms,
+     basicGetmeSimultaneous_throwIfActiveSetFractionInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.activeSetRelocationDistanceFraction = 1.5;
+
+  EXPECT_ANY_THROW(Smoothing::basicGetmeSimultaneous(initialMesh, config));
+}
+
+TEST(GetmeAlgorithms, basicGetmeSimultaneous_activeSet) {
+  // The non fixed nodes of the sample mesh share a polygon. Hence, no node is
+  // frozen before termination and the results of both modes match.
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  const auto expectedResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+  config.activeSetRelocationDistanceFraction = 1.0;
+
+  const auto activeSetResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+
+  EXPECT_EQ(expectedResult.iterations, activeSetResult.iterations);
+  const double nodeTolerance = 1.0e-15;
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh,
+                             nodeTolerance));
+}
+
+TEST(GetmeAlgorithms, basicGetmeSimultaneous_activeSetFreezing) {
+  // Nodes away from the perturbed node do not move initially and are frozen.
+  // Moving neighbors reactivate them while the perturbation spreads.
+  const auto initialMesh = Testdata::getLocallyPerturbedGridMesh();
+  const double maxNodeRelocationDistanceThreshold = 1.0e-3;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  const auto expectedResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+  // Deviations of frozen nodes accumulate over the iterations. Hence, the
+  // freezing distance is chosen well below the threshold.
+  config.activeSetRelocationDistanceFraction = 0.1;
+  const auto activeSetResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+  Smoothing::SmoothingWorkspace workspace;
+  config.maxIterations = 1;
+  Smoothing::basicGetmeSimultaneous(initialMesh, config, workspace);
+  const auto isActiveAfterFirstIteration =
+      workspace.getActiveSetBuffers().isNextActiveNode;
+  config.maxIterations = 2;
+  Smoothing::basicGetmeSimultaneous(initialMesh, config, workspace);
+  const auto& isActiveAfterSecondIteration =
+      workspace.getActiveSetBuffers().isNextActiveNode;
+
+  std::size_t numberOfFrozenNodes = 0;
+  std::size_t numberOfReactivatedNodes = 0;
+  for (const auto nodeIndex : initialMesh.getNonFixedNodeIndices()) {
+    if (!isActiveAfterFirstIteration.at(nodeIndex)) {
+      ++numberOfFrozenNodes;
+      if (isActiveAfterSecondIteration.at(nodeIndex)) {
+        ++numberOfReactivatedNodes;
+      }
+    }
+  }
+  EXPECT_GT(numberOfFrozenNodes, 0);
+  EXPECT_GT(numberOfReactivatedNodes, 0);
+  EXPECT_LT(numberOfReactivatedNodes, numberOfFrozenNodes);
+  EXPECT_FALSE(Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh));
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh,
+                             maxNodeRelocationDistanceThreshold));
+}
+
+TEST(GetmeAlgorithms, basicGetmeSimultaneous_activeSetConvergedForWholeMesh) {
+  // With a freezing distance equal to the threshold, frozen nodes may move
+  // farther than the threshold. Termination nevertheless requires all nodes to
+  // move less than the threshold. Hence, another iteration without active set
+  // moves nodes less than the threshold.
+  const auto initialMesh = Testdata::getLocallyPerturbedGridMesh();
+  const double maxNodeRelocationDistanceThreshold = 1.0e-4;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.activeSetRelocationDistanceFraction = 1.0;
+  const auto activeSetResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+  config.activeSetRelocationDistanceFraction = 0.0;
+  config.maxIterations = 1;
+
+  const auto nextIterationMesh =
+      Smoothing::basicGetmeSimultaneous(activeSetResult.mesh, config).mesh;
+
+  EXPECT_TRUE(Mesh::areEqual(activeSetResult.mesh, nextIterationMesh,
+                             maxNodeRelocationDistanceThreshold));
+}
+
+TEST(GetmeAlgorithms, basicGetmeSimultaneous_momentum) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  // Set relocation distance threshold to zero to perform max iterations.
+  const double maxNodeRelocationDistanceThreshold = 0.0;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.maxIterations = 1;
+  const auto firstIterationMesh =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config).mesh;
+  const auto secondIterationMesh =
+      Smoothing::basicGetmeSimultaneous(firstIterationMesh, config).mesh;
+  config.momentumFactor = 0.5;
+  const Mesh::PolygonalMesh expectedMesh(
+      getSecondMomentumIterationNodes(initialMesh, firstIterationMesh,
+                                      secondIterationMesh,
+                                      config.momentumFactor),
+      initialMesh.getPolygons(), initialMesh.getFixedNodeIndices());
+  config.maxIterations = 2;
+
+  const auto getmeResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+
+  const double nodeTolerance = 1.0e-15;
+  EXPECT_TRUE(Mesh::areEqual(expectedMesh, getmeResult.mesh, nodeTolerance));
+  EXPECT_EQ(2, getmeResult.iterations);
+}
+
 TEST(GetmeAlgorithms, getmeSimultaneous_throwIfTransformationsNotRegularizing) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   Smoothing::GetmeSimultaneousConfig config(
@@ -145,6 +317,87 @@ TEST(GetmeAlgorithms, getmeSimultaneous_maxIterTerminated) {
                              nodeTolerance));
 }
 
+TEST(GetmeAlgorithms, getmeSimultaneous_wallClockTimeTerminated) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.maxWallClockTimeInSeconds = -1.0;
+  EXPECT_ANY_THROW(Smoothing::getmeSimultaneous(initialMesh, config));
+
+  // A zero time limit results in exactly one iteration.
+  config.maxWallClockTimeInSeconds = 0.0;
+  const auto result = Smoothing::getmeSimultaneous(initialMesh, config);
+  Smoothing::GetmeSimultaneousConfig singleIterationConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  singleIterationConfig.maxIterations = 1;
+  const auto expectedResult =
+      Smoothing::getmeSimultaneous(initialMesh, singleIterationConfig);
+
+  EXPECT_EQ(1, result.iterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_qualityTargetsReached) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.qualityTargets.qMean = 0.9;
+  const auto qMeanResult = Smoothing::getmeSimultaneous(initialMesh, config);
+  config.qualityTargets.qMean.reset();
+  config.qualityTargets.qMinStar = 0.76;
+  const auto qMinStarResult = Smoothing::getmeSimultaneous(initialMesh, config);
+  Smoothing::GetmeSimultaneousConfig expectedConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  expectedConfig.maxIterations = 3;
+  const auto expectedResult =
+      Smoothing::getmeSimultaneous(initialMesh, expectedConfig);
+
+  EXPECT_EQ(3, qMeanResult.iterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, qMeanResult.mesh));
+  EXPECT_EQ(2, qMinStarResult.iterations);
+  EXPECT_GE(qMinStarResult.meshQuality.getQMinStar().value(), 0.76);
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_observerCancelled) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.observer.callback =
+      [](const Smoothing::SmoothingProgress& progress) {
+        return progress.iteration < 3;
+      };
+  const auto result = Smoothing::getmeSimultaneous(initialMesh, config);
+  Smoothing::GetmeSimultaneousConfig expectedConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  expectedConfig.maxIterations = 3;
+  const auto expectedResult =
+      Smoothing::getmeSimultaneous(initialMesh, expectedConfig);
+
+  EXPECT_EQ(3, result.iterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_convergenceHistory) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.convergenceHistoryInterval = 1;
+
+  const auto result = Smoothing::getmeSimultaneous(initialMesh, config);
+
+  const auto& history = result.convergenceHistory;
+  ASSERT_EQ(result.iterations, history.size());
+  for (std::size_t index = 0; index < history.size(); ++index) {
+    EXPECT_EQ(index + 1, history.at(index).iteration);
+    EXPECT_GT(history.at(index).maxNodeRelocationDistance, 0.0);
+    EXPECT_EQ(0, history.at(index).numberOfInvalidElementNodeResets.value());
+  }
+  // The result is the mesh of the last iteration, which has the best q_mean.
+  EXPECT_DOUBLE_EQ(result.meshQuality.getQMean(), history.back().qMean);
+  EXPECT_DOUBLE_EQ(result.meshQuality.getQMinStar().value(),
+                   history.back().qMinStar.value());
+}
+
 TEST(GetmeAlgorithms, getmeSimultaneous_qualityTerminated) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   auto expectedNodes = initialMesh.getNodes();
@@ -166,6 +419,150 @@ TEST(GetmeAlgorithms, getmeSimultaneous_qualityTerminated) {
                              nodeTolerance));
 }
 
+TEST(GetmeAlgorithms, getmeSimultaneous_throwIfSaturationThresholdInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.saturationWeightThreshold = 1.0;
+
+  EXPECT_ANY_THROW(Smoothing::getmeSimultaneous(initialMesh, config));
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_throwIfMomentumFactorInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.momentumFactor = -0.1;
+
+  EXPECT_ANY_THROW(Smoothing::getmeSimultaneous(initialMesh, config));
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_momentum) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.qMeanImprovementThreshold = 0.0;
+  config.maxIterations = 1;
+  const auto firstIterationMesh =
+      Smoothing::getmeSimultaneous(initialMesh, config).mesh;
+  const auto secondIterationMesh =
+      Smoothing::getmeSimultaneous(firstIterationMesh, config).mesh;
+  config.momentumFactor = 0.5;
+  const Mesh::PolygonalMesh expectedMesh(
+      getSecondMomentumIterationNodes(initialMesh, firstIterationMesh,
+                                      secondIterationMesh,
+                                      config.momentumFactor),
+      initialMesh.getPolygons(), initialMesh.getFixedNodeIndices());
+  config.maxIterations = 2;
+
+  const auto getmeSimultaneousResult =
+      Smoothing::getmeSimultaneous(initialMesh, config);
+
+  const double nodeTolerance = 1.0e-15;
+  EXPECT_TRUE(Mesh::areEqual(expectedMesh, getmeSimultaneousResult.mesh,
+                             nodeTolerance));
+  EXPECT_EQ(2, getmeSimultaneousResult.iterations);
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_momentumPreservesValidity) {
+  // Strong momentum overshoots the nodes moving over long distances, which
+  // results in invalid elements. Their nodes are reset, which keeps all
+  // iterated meshes valid.
+  const auto initialMesh = getGradedGridMesh();
+  ASSERT_TRUE(Mesh::MeshQuality(initialMesh).isValidMesh());
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.momentumFactor = 0.95;
+  // Continue despite quality losses to provoke overshooting.
+  config.qMeanImprovementThreshold = -1.0;
+  config.maxIterations = 30;
+  config.convergenceHistoryInterval = 1;
+
+  const auto getmeSimultaneousResult =
+      Smoothing::getmeSimultaneous(initialMesh, config);
+
+  EXPECT_EQ(config.maxIterations, getmeSimultaneousResult.iterations);
+  std::size_t numberOfNodeResets = 0;
+  for (const auto& record : getmeSimultaneousResult.convergenceHistory) {
+    EXPECT_GT(record.qMin, 0.0);
+    ASSERT_TRUE(record.numberOfInvalidElementNodeResets.has_value());
+    numberOfNodeResets += *record.numberOfInvalidElementNodeResets;
+  }
+  EXPECT_GT(numberOfNodeResets, 0);
+  EXPECT_TRUE(getmeSimultaneousResult.meshQuality.isValidMesh());
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_allPolygonsSaturated) {
+  // All polygon weights are below the threshold. Hence, no polygon is
+  // transformed and nodes keep their positions up to rounding errors of the
+  // weighted averaging.
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.weightExponentEta = 1.0;
+  config.saturationWeightThreshold = 0.999;
+
+  const auto getmeSimultaneousResult =
+      Smoothing::getmeSimultaneous(initialMesh, config);
+
+  EXPECT_EQ(1, getmeSimultaneousResult.iterations);
+  const double nodeTolerance = 1.0e-14;
+  EXPECT_TRUE(Mesh::areEqual(initialMesh, getmeSimultaneousResult.mesh,
+                             nodeTolerance));
+}
+
+TEST(GetmeAlgorithms, basicGetmeSimultaneous_singlePrecision) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.2;
+  Smoothing::BasicGetmeSimultaneousConfig config(
+      maxNodeRelocationDistanceThreshold,
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  const auto doublePrecisionResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+  config.floatingPointPrecision =
+      Smoothing::DefaultConfiguration::FloatingPointPrecision::Single;
+
+  const auto singlePrecisionResult =
+      Smoothing::basicGetmeSimultaneous(initialMesh, config);
+
+  EXPECT_EQ(doublePrecisionResult.iterations,
+            singlePrecisionResult.iterations);
+  const double nodeTolerance = 1.0e-5;
+  EXPECT_TRUE(Mesh::areEqual(doublePrecisionResult.mesh,
+                             singlePrecisionResult.mesh, nodeTolerance));
+  for (const auto nodeIndex : initialMesh.getFixedNodeIndices()) {
+    EXPECT_EQ(initialMesh.getNodes().at(nodeIndex),
+              singlePrecisionResult.mesh.getNodes().at(nodeIndex));
+  }
+}
+
+TEST(GetmeAlgorithms, getmeSimultaneous_singleAndMixedPrecision) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSimultaneousConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.qMeanImprovementThreshold = 0.01;
+  const auto doublePrecisionResult =
+      Smoothing::getmeSimultaneous(initialMesh, config);
+
+  for (const auto precision :
+       {Smoothing::DefaultConfiguration::FloatingPointPrecision::Single,
+        Smoothing::DefaultConfiguration::FloatingPointPrecision::Mixed}) {
+    config.floatingPointPrecision = precision;
+
+    const auto result = Smoothing::getmeSimultaneous(initialMesh, config);
+
+    EXPECT_EQ(doublePrecisionResult.iterations, result.iterations);
+    const double nodeTolerance = 1.0e-5;
+    EXPECT_TRUE(Mesh::areEqual(doublePrecisionResult.mesh, result.mesh,
+                               nodeTolerance));
+    EXPECT_TRUE(result.meshQuality.isValidMesh());
+    for (const auto nodeIndex : initialMesh.getFixedNodeIndices()) {
+      EXPECT_EQ(initialMesh.getNodes().at(nodeIndex),
+                result.mesh.getNodes().at(nodeIndex));
+    }
+  }
+}
+
 TEST(GetmeAlgorithms, getmeSequential_throwIfTransformationsNotRegularizing) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   Smoothing::GetmeSequentialConfig config(
@@ -214,6 +611,81 @@ TEST(GetmeAlgorithms, getmeSequential_maxIterTerminated) {
       Mesh::areEqual(expectedMesh, getmeSequentialResult.mesh, nodeTolerance));
 }
 
+TEST(GetmeAlgorithms, getmeSequential_wallClockTimeTerminated) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSequentialConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.maxWallClockTimeInSeconds = -1.0;
+  EXPECT_ANY_THROW(Smoothing::getmeSequential(initialMesh, config));
+
+  // A zero time limit results in exactly one iteration.
+  config.maxWallClockTimeInSeconds = 0.0;
+  const auto result = Smoothing::getmeSequential(initialMesh, config);
+
+  EXPECT_EQ(1, result.iterations);
+  EXPECT_GT(result.meshQuality.getQMinStar().value(),
+            Mesh::MeshQuality(initialMesh).getQMinStar().value());
+}
+
+TEST(GetmeAlgorithms, getmeSequential_qualityTargetsReached) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSequentialConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.qualityTargets.qMin = 0.78;
+  config.qualityTargets.qMean = 0.85;
+
+  const auto result = Smoothing::getmeSequential(initialMesh, config);
+
+  // Targets are checked after each smoothing cycle.
+  EXPECT_LT(result.iterations, 3800);
+  EXPECT_EQ(0, result.iterations % config.qualityEvaluationCycleLength);
+  EXPECT_GE(result.meshQuality.getQMin(), 0.78);
+  EXPECT_GE(result.meshQuality.getQMean(), 0.85);
+}
+
+TEST(GetmeAlgorithms, getmeSequential_qMinStarTargetCheckedEachIteration) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSequentialConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  const double qMinStarTarget = 0.77;
+  config.convergenceHistoryInterval = 1;
+  const auto history =
+      Smoothing::getmeSequential(initialMesh, config).convergenceHistory;
+  const auto reachingRecord = std::find_if(
+      history.begin(), history.end(),
+      [&](const Smoothing::ConvergenceRecord& record) {
+        return record.qMinStar.value() >= qMinStarTarget;
+      });
+  ASSERT_NE(history.end(), reachingRecord);
+  config.convergenceHistoryInterval = 0;
+  config.qualityTargets.qMinStar = qMinStarTarget;
+
+  const auto result = Smoothing::getmeSequential(initialMesh, config);
+
+  // Terminates in the first iteration reaching the target, which is not at
+  // the end of a smoothing cycle.
+  EXPECT_EQ(reachingRecord->iteration, result.iterations);
+  EXPECT_NE(0, result.iterations % config.qualityEvaluationCycleLength);
+  EXPECT_GE(result.meshQuality.getQMinStar().value(), qMinStarTarget);
+}
+
+TEST(GetmeAlgorithms, getmeSequential_observerCancelled) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeSequentialConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.observer.iterationInterval = 100;
+  config.observer.callback =
+      [](const Smoothing::SmoothingProgress& progress) {
+        return progress.iteration < 200;
+      };
+
+  const auto result = Smoothing::getmeSequential(initialMesh, config);
+
+  EXPECT_EQ(200, result.iterations);
+  EXPECT_GT(result.meshQuality.getQMinStar().value(),
+            Mesh::MeshQuality(initialMesh).getQMinStar().value());
+}
+
 TEST(GetmeAlgorithms, getmeSequential_qualityTerminated) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   auto expectedNodes = initialMesh.getNodes();
@@ -242,6 +714,180 @@ TEST(GetmeAlgorithms, getme_throwIfMeshIsInvalid) {
   EXPECT_ANY_THROW(Smoothing::getme(invalidInitialMesh, getmeConfig));
 }
 
+TEST(GetmeAlgorithms, getme_throwIfWallClockTimeConfigInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  getmeConfig.maxWallClockTimeInSeconds = -1.0;
+  EXPECT_ANY_THROW(Smoothing::getme(initialMesh, getmeConfig));
+  getmeConfig.maxWallClockTimeInSeconds = 1.0;
+  getmeConfig.getmeSimultaneousWallClockTimeFraction = 1.5;
+  EXPECT_ANY_THROW(Smoothing::getme(initialMesh, getmeConfig));
+}
+
+TEST(GetmeAlgorithms, getme_wallClockTimeTerminated) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  // A zero time limit results in exactly one iteration of both phases.
+  getmeConfig.maxWallClockTimeInSeconds = 0.0;
+
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  EXPECT_EQ(1, getmeResult.getmeSimultaneousIterations);
+  EXPECT_EQ(1, getmeResult.getmeSequentialIterations);
+  EXPECT_TRUE(getmeResult.meshQuality.isValidMesh());
+}
+
+TEST(GetmeAlgorithms, getme_qualityTargetsReached) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  // Reached by GETMe simultaneous, hence GETMe sequential is skipped.
+  getmeConfig.qualityTargets.qMean = 0.9;
+  const auto skippedResult = Smoothing::getme(initialMesh, getmeConfig);
+  // Only reached by GETMe sequential.
+  getmeConfig.qualityTargets.qMean.reset();
+  getmeConfig.qualityTargets.qMinStar = 0.77;
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  EXPECT_EQ(3, skippedResult.getmeSimultaneousIterations);
+  EXPECT_EQ(0, skippedResult.getmeSequentialIterations);
+  EXPECT_GE(skippedResult.meshQuality.getQMean(), 0.9);
+  EXPECT_EQ(10, getmeResult.getmeSimultaneousIterations);
+  EXPECT_GT(getmeResult.getmeSequentialIterations, 0);
+  EXPECT_LT(getmeResult.getmeSequentialIterations, 3800);
+  EXPECT_GE(getmeResult.meshQuality.getQMinStar().value(), 0.77);
+}
+
+TEST(GetmeAlgorithms, getme_observerCancelled) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  std::vector<std::size_t> observedSequentialIterations;
+  getmeConfig.observer.iterationInterval = 1000;
+  getmeConfig.observer.callback =
+      [&](const Smoothing::SmoothingProgress& progress) {
+        if (progress.algorithmName == "GETMe sequential") {
+          observedSequentialIterations.push_back(progress.iteration);
+        }
+        return true;
+      };
+  const auto observedResult = Smoothing::getme(initialMesh, getmeConfig);
+  // Cancelling GETMe simultaneous skips GETMe sequential.
+  getmeConfig.observer.iterationInterval = 1;
+  getmeConfig.observer.callback =
+      [](const Smoothing::SmoothingProgress& progress) {
+        return progress.iteration < 2;
+      };
+  const auto cancelledResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  EXPECT_EQ(3800, observedResult.getmeSequentialIterations);
+  EXPECT_EQ(std::vector<std::size_t>({1000, 2000, 3000}),
+            observedSequentialIterations);
+  EXPECT_EQ(2, cancelledResult.getmeSimultaneousIterations);
+  EXPECT_EQ(0, cancelledResult.getmeSequentialIterations);
+}
+
+TEST(GetmeAlgorithms, getme_convergenceHistory) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  getmeConfig.getmeSimultaneousConfig.convergenceHistoryInterval = 5;
+  getmeConfig.getmeSequentialConfig.convergenceHistoryInterval = 1000;
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+  getmeConfig.convergenceHistoryInterval = 2000;
+  const auto replacedIntervalResult =
+      Smoothing::getme(initialMesh, getmeConfig);
+
+  // GETMe sequential records follow the GETMe simultaneous records.
+  const auto& history = getmeResult.convergenceHistory;
+  ASSERT_EQ(5, history.size());
+  EXPECT_EQ(10, history.at(1).iteration);
+  EXPECT_EQ(1010, history.at(2).iteration);
+  EXPECT_EQ(3010, history.at(4).iteration);
+  EXPECT_GT(history.at(2).elapsedWallClockTimeInSeconds,
+            history.at(1).elapsedWallClockTimeInSeconds);
+  EXPECT_GT(history.at(4).qMinStar.value(), history.at(1).qMinStar.value());
+  ASSERT_EQ(1, replacedIntervalResult.convergenceHistory.size());
+  EXPECT_EQ(2010, replacedIntervalResult.convergenceHistory.at(0).iteration);
+}
+
+TEST(GetmeAlgorithms, getme_phaseTimes) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  const auto& phases = getmeResult.phaseTimes.getPhases();
+  if constexpr (!Utility::arePhaseTimersEnabled) {
+    EXPECT_TRUE(phases.empty());
+    return;
+  }
+  const auto hasPhase = [&](const std::string_view phaseName) {
+    return std::any_of(
+        phases.begin(), phases.end(),
+        [&](const auto& phase) { return phase.name == phaseName; });
+  };
+  EXPECT_TRUE(hasPhase("GETMe simultaneous transformation"));
+  EXPECT_TRUE(hasPhase("GETMe simultaneous invalid element reset"));
+  EXPECT_TRUE(hasPhase("GETMe sequential min heap update"));
+  double phaseTimeSum = 0.0;
+  for (const auto& phase : phases) {
+    EXPECT_GE(phase.timeInSeconds, 0.0);
+    phaseTimeSum += phase.timeInSeconds;
+  }
+  EXPECT_LE(phaseTimeSum, getmeResult.smoothingWallClockTimeInSeconds);
+}
+
+TEST(GetmeAlgorithms, getme_eventCounts) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  const auto& eventCounts = getmeResult.eventCounts;
+  if constexpr (!Utility::areEventCountersEnabled) {
+    EXPECT_TRUE(eventCounts.isZero());
+    return;
+  }
+  // Each GETMe sequential iteration transforms one polygon.
+  EXPECT_GE(eventCounts.get(Utility::Event::PolygonTransformation),
+            getmeResult.getmeSequentialIterations);
+  EXPECT_GT(eventCounts.get(Utility::Event::MeanRatioEvaluation),
+            eventCounts.get(Utility::Event::PolygonTransformation));
+  EXPECT_GT(eventCounts.get(Utility::Event::HeapSiftStep), 0);
+}
+
+TEST(GetmeAlgorithms, getme_peakScratchMemory) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const Smoothing::GetmeConfig getmeConfig(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  Smoothing::SmoothingWorkspace workspace;
+
+  const auto getmeSimultaneousResult = Smoothing::getmeSimultaneous(
+      initialMesh, getmeConfig.getmeSimultaneousConfig, workspace);
+  const auto simultaneousCapacity = workspace.getCapacityInBytes();
+  const auto getmeSequentialResult = Smoothing::getmeSequential(
+      getmeSimultaneousResult.mesh, getmeConfig.getmeSequentialConfig,
+      workspace);
+  const auto getmeResult = Smoothing::getme(initialMesh, getmeConfig);
+
+  EXPECT_EQ(simultaneousCapacity,
+            getmeSimultaneousResult.peakScratchMemoryInBytes);
+  EXPECT_EQ(workspace.getCapacityInBytes(),
+            getmeSequentialResult.peakScratchMemoryInBytes);
+  // The min heap holds at least one entry per polygon.
+  EXPECT_GT(getmeSequentialResult.peakScratchMemoryInBytes,
+            simultaneousCapacity
+                + initialMesh.getNumberOfPolygons() * sizeof(double));
+  // GETMe simultaneous and GETMe sequential share a workspace.
+  EXPECT_EQ(getmeSequentialResult.peakScratchMemoryInBytes,
+            getmeResult.peakScratchMemoryInBytes);
+}
+
 TEST(GetmeAlgorithms, getme) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   auto expectedNodes = initialMesh.getNodes();
@@ -260,3 +906,72 @@ TEST(GetmeAlgorithms, getme) {
   const double nodeTolerance = 1.0e-15;
   EXPECT_TRUE(Mesh::areEqual(expectedMesh, getmeResult.mesh, nodeTolerance));
 }
+
+TEST(GetmeAlgorithms, multilevelGetme_throwIfMeshIsInvalid) {
+  const auto invalidInitialMesh = Testdata::getInvalidMixedSampleMesh();
+  const Smoothing::MultilevelGetmeConfig config(
+      invalidInitialMesh.getMaximalNumberOfPolygonNodes());
+  EXPECT_ANY_THROW(Smoothing::multilevelGetme(invalidInitialMesh, config));
+}
+
+TEST(GetmeAlgorithms, multilevelGetme_withoutCoarseLevels) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  // The sample mesh has too few non fixed nodes for coarse levels. Thus,
+  // multilevel GETMe is equivalent to GETMe.
+  const Smoothing::MultilevelGetmeConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+
+  const auto result = Smoothing::multilevelGetme(initialMesh, config);
+  const auto getmeResult = Smoothing::getme(initialMesh, config.getmeConfig);
+
+  EXPECT_EQ(0, result.numberOfCoarseLevels);
+  EXPECT_EQ(getmeResult.getmeSimultaneousIterations,
+            result.getmeSimultaneousIterations);
+  EXPECT_EQ(getmeResult.getmeSequentialIterations,
+            result.getmeSequentialIterations);
+  EXPECT_TRUE(Mesh::areEqual(getmeResult.mesh, result.mesh));
+}
+
+TEST(GetmeAlgorithms, multilevelGetme_withCoarseLevels) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::MultilevelGetmeConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.minNumberOfCoarseNonFixedNodes = 1;
+
+  const auto result = Smoothing::multilevelGetme(initialMesh, config);
+
+  // The third coarsening does not contain non fixed nodes.
+  EXPECT_EQ(2, result.numberOfCoarseLevels);
+  EXPECT_TRUE(result.meshQuality.isValidMesh());
+  EXPECT_GT(result.meshQuality.getQMin(),
+            Mesh::MeshQuality(initialMesh).getQMin());
+}
+
+TEST(GetmeAlgorithms, multilevelGetme_coarseLevelsReduceLargeScaleShear) {
+  Testdata::MeshGeneratorConfig generatorConfig;
+  generatorConfig.numberOfCellsX = 32;
+  generatorConfig.numberOfCellsY = 32;
+  auto initialMesh = Testdata::generateGridMesh(
+      generatorConfig, Testdata::GridElementType::Quadrilateral);
+  for (const auto nodeIndex : initialMesh.getNonFixedNodeIndices()) {
+    auto& node = initialMesh.getMutableNodes().at(nodeIndex);
+    node += Mathematics::Vector2D(
+        2.0 * std::sin(std::numbers::pi * node.getX() / 32.0)
+            * std::sin(std::numbers::pi * node.getY() / 32.0),
+        0.0);
+  }
+  // Limit GETMe to few iterations, such that the result mainly depends on the
+  // coarse levels.
+  Smoothing::MultilevelGetmeConfig config(
+      initialMesh.getMaximalNumberOfPolygonNodes());
+  config.getmeConfig.getmeSimultaneousConfig.maxIterations = 1;
+  config.getmeConfig.getmeSequentialConfig.qualityEvaluationCycleLength = 1;
+  config.getmeConfig.getmeSequentialConfig.maxIterations = 2;
+
+  const auto result = Smoothing::multilevelGetme(initialMesh, config);
+  const auto getmeResult = Smoothing::getme(initialMesh, config.getmeConfig);
+
+  EXPECT_LT(0, result.numberOfCoarseLevels);
+  EXPECT_TRUE(result.meshQuality.isValidMesh());
+  EXPECT_GT(result.meshQuality.getQMean(), getmeResult.meshQuality.getQMean());
+}
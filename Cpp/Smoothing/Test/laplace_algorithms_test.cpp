@@ -27,12 +27,16 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Smoothing/basic_laplace_config.h"
 #include "Smoothing/laplace_algorithms.h"
 #include "Smoothing/smart_laplace_config.h"
+#include "Smoothing/smoothing_observer.h"
 #include "Smoothing/smoothing_result.h"
+#include "Smoothing/smoothing_workspace.h"
 #include "Testdata/meshes.h"
 
 #include "gtest/gtest.h"
 
 #include <cmath>
+#include <string>
+#include <vector>
 
 namespace {
 // Helper functions based on the mixed sample mesh.
@@ -114,6 +118,206 @@ TEST(LaplaceAlgorithms, basicLaplace_thresholdTerminated) {
   EXPECT_EQ(1, laplaceResult.iterations);
 }
 
+TEST(LaplaceAlgorithms, basicLaplace_wallClockTimeTerminated) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::BasicLaplaceConfig config(0.0);
+  config.maxWallClockTimeInSeconds = -1.0;
+  EXPECT_ANY_THROW(Smoothing::basicLaplace(initialMesh, config));
+
+  // A zero time limit results in exactly one iteration.
+  config.maxWallClockTimeInSeconds = 0.0;
+  const auto result = Smoothing::basicLaplace(initialMesh, config);
+  Smoothing::BasicLaplaceConfig singleIterationConfig(0.0);
+  singleIterationConfig.maxIterations = 1;
+  const auto expectedResult =
+      Smoothing::basicLaplace(initialMesh, singleIterationConfig);
+
+  EXPECT_EQ(1, result.iterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_observerCancelled) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::BasicLaplaceConfig config(0.0);
+  config.observer.callback = [](const Smoothing::SmoothingProgress&) {
+    return true;
+  };
+  config.observer.iterationInterval = 0;
+  EXPECT_ANY_THROW(Smoothing::basicLaplace(initialMesh, config));
+
+  std::vector<std::size_t> observedIterations;
+  config.observer.iterationInterval = 2;
+  config.observer.callback =
+      [&](const Smoothing::SmoothingProgress& progress) {
+        EXPECT_EQ("Basic Laplace", progress.algorithmName);
+        EXPECT_TRUE(progress.meshQuality.isValidMesh());
+        observedIterations.push_back(progress.iteration);
+        return progress.iteration < 4;
+      };
+  const auto result = Smoothing::basicLaplace(initialMesh, config);
+  Smoothing::BasicLaplaceConfig expectedConfig(0.0);
+  expectedConfig.maxIterations = 4;
+  const auto expectedResult =
+      Smoothing::basicLaplace(initialMesh, expectedConfig);
+
+  EXPECT_EQ(4, result.iterations);
+  EXPECT_EQ(std::vector<std::size_t>({2, 4}), observedIterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_convergenceHistory) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::BasicLaplaceConfig config(0.0);
+  config.maxIterations = 5;
+  EXPECT_TRUE(Smoothing::basicLaplace(initialMesh, config)
+                  .convergenceHistory.empty());
+
+  config.convergenceHistoryInterval = 2;
+  const auto result = Smoothing::basicLaplace(initialMesh, config);
+  config.maxIterations = 4;
+  const auto fourIterationsResult =
+      Smoothing::basicLaplace(initialMesh, config);
+
+  const auto& history = result.convergenceHistory;
+  ASSERT_EQ(2, history.size());
+  EXPECT_EQ(2, history.at(0).iteration);
+  EXPECT_EQ(4, history.at(1).iteration);
+  EXPECT_GT(history.at(0).maxNodeRelocationDistance,
+            history.at(1).maxNodeRelocationDistance);
+  EXPECT_FALSE(history.at(1).numberOfInvalidElementNodeResets.has_value());
+  EXPECT_EQ(fourIterationsResult.meshQuality.getQMin(), history.at(1).qMin);
+  EXPECT_EQ(fourIterationsResult.meshQuality.getQMinStar(),
+            history.at(1).qMinStar);
+  EXPECT_EQ(fourIterationsResult.meshQuality.getQMean(), history.at(1).qMean);
+  EXPECT_LE(history.at(0).elapsedWallClockTimeInSeconds,
+            history.at(1).elapsedWallClockTimeInSeconds);
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_throwIfActiveSetFractionInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  config.activeSetRelocationDistanceFraction = -0.5;
+
+  EXPECT_ANY_THROW(Smoothing::basicLaplace(initialMesh, config));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_activeSet) {
+  // The non fixed nodes of the sample mesh are edge connected. Hence, no node
+  // is frozen before termination and the results of both modes match.
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  const auto expectedResult = Smoothing::basicLaplace(initialMesh, config);
+  config.activeSetRelocationDistanceFraction = 1.0;
+
+  const auto activeSetResult = Smoothing::basicLaplace(initialMesh, config);
+
+  EXPECT_EQ(expectedResult.iterations, activeSetResult.iterations);
+  const double tolerance = 1.0e-15;
+  EXPECT_TRUE(
+      Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh, tolerance));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_activeSetFreezing) {
+  // Nodes away from the perturbed node do not move initially and are frozen.
+  // Moving neighbors reactivate them while the perturbation spreads.
+  const auto initialMesh = Testdata::getLocallyPerturbedGridMesh();
+  const double maxNodeRelocationDistanceThreshold = 1.0e-3;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  const auto expectedResult = Smoothing::basicLaplace(initialMesh, config);
+  // Deviations of frozen nodes accumulate over the iterations. Hence, the
+  // freezing distance is chosen well below the threshold.
+  config.activeSetRelocationDistanceFraction = 0.1;
+  const auto activeSetResult = Smoothing::basicLaplace(initialMesh, config);
+  Smoothing::SmoothingWorkspace workspace;
+  config.maxIterations = 1;
+  Smoothing::basicLaplace(initialMesh, config, workspace);
+  const auto isActiveAfterFirstIteration =
+      workspace.getActiveSetBuffers().isNextActiveNode;
+  config.maxIterations = 2;
+  Smoothing::basicLaplace(initialMesh, config, workspace);
+  const auto& isActiveAfterSecondIteration =
+      workspace.getActiveSetBuffers().isNextActiveNode;
+
+  std::size_t numberOfFrozenNodes = 0;
+  std::size_t numberOfReactivatedNodes = 0;
+  for (const auto nodeIndex : initialMesh.getNonFixedNodeIndices()) {
+    if (!isActiveAfterFirstIteration.at(nodeIndex)) {
+      ++numberOfFrozenNodes;
+      if (isActiveAfterSecondIteration.at(nodeIndex)) {
+        ++numberOfReactivatedNodes;
+      }
+    }
+  }
+  EXPECT_GT(numberOfFrozenNodes, 0);
+  EXPECT_GT(numberOfReactivatedNodes, 0);
+  EXPECT_LT(numberOfReactivatedNodes, numberOfFrozenNodes);
+  EXPECT_FALSE(Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh));
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, activeSetResult.mesh,
+                             maxNodeRelocationDistanceThreshold));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_activeSetConvergedForWholeMesh) {
+  // With a freezing distance equal to the threshold, frozen nodes may move
+  // farther than the threshold. Termination nevertheless requires all nodes to
+  // move less than the threshold. Hence, another iteration without active set
+  // moves nodes less than the threshold.
+  const auto initialMesh = Testdata::getLocallyPerturbedGridMesh();
+  const double maxNodeRelocationDistanceThreshold = 1.0e-4;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  config.activeSetRelocationDistanceFraction = 1.0;
+  const auto activeSetResult = Smoothing::basicLaplace(initialMesh, config);
+  config.activeSetRelocationDistanceFraction = 0.0;
+  config.maxIterations = 1;
+
+  const auto nextIterationMesh =
+      Smoothing::basicLaplace(activeSetResult.mesh, config).mesh;
+
+  EXPECT_TRUE(Mesh::areEqual(activeSetResult.mesh, nextIterationMesh,
+                             maxNodeRelocationDistanceThreshold));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_throwIfMomentumFactorInvalid) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  config.momentumFactor = 1.0;
+
+  EXPECT_ANY_THROW(Smoothing::basicLaplace(initialMesh, config));
+}
+
+TEST(LaplaceAlgorithms, basicLaplace_momentum) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  // Set relocation distance threshold to zero to perform max iterations.
+  const double maxNodeRelocationDistanceThreshold = 0.0;
+  Smoothing::BasicLaplaceConfig config(maxNodeRelocationDistanceThreshold);
+  config.maxIterations = 1;
+  // Without previous update, the first iteration equals plain smoothing.
+  const auto firstIterationMesh =
+      Smoothing::basicLaplace(initialMesh, config).mesh;
+  const auto secondIterationMesh =
+      Smoothing::basicLaplace(firstIterationMesh, config).mesh;
+  config.momentumFactor = 0.5;
+  auto expectedNodes = secondIterationMesh.getNodes();
+  for (const auto nodeIndex : initialMesh.getNonFixedNodeIndices()) {
+    expectedNodes.at(nodeIndex) +=
+        config.momentumFactor
+        * (firstIterationMesh.getNodes().at(nodeIndex)
+           - initialMesh.getNodes().at(nodeIndex));
+  }
+  const Mesh::PolygonalMesh expectedMesh(expectedNodes,
+                                         initialMesh.getPolygons(),
+                                         initialMesh.getFixedNodeIndices());
+  config.maxIterations = 2;
+
+  const auto laplaceResult = Smoothing::basicLaplace(initialMesh, config);
+
+  const double tolerance = 1.0e-15;
+  EXPECT_TRUE(Mesh::areEqual(expectedMesh, laplaceResult.mesh, tolerance));
+  EXPECT_EQ(2, laplaceResult.iterations);
+}
+
 TEST(LaplaceAlgorithms, smartLaplace_requiresValidMesh) {
   const auto invalidMesh = Testdata::getInvalidMixedSampleMesh();
   const Smoothing::SmartLaplaceConfig config;
@@ -139,6 +343,40 @@ TEST(LaplaceAlgorithms, smartLaplace_maxIterTerminated) {
   EXPECT_TRUE(Mesh::areEqual(expectedMesh, smoothingResult.mesh, tolerance));
 }
 
+TEST(LaplaceAlgorithms, smartLaplace_wallClockTimeTerminated) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::SmartLaplaceConfig config;
+  config.maxWallClockTimeInSeconds = -1.0;
+  EXPECT_ANY_THROW(Smoothing::smartLaplace(initialMesh, config));
+
+  // A zero time limit results in exactly one iteration.
+  config.maxWallClockTimeInSeconds = 0.0;
+  const auto result = Smoothing::smartLaplace(initialMesh, config);
+  Smoothing::SmartLaplaceConfig singleIterationConfig;
+  singleIterationConfig.maxIterations = 1;
+  const auto expectedResult =
+      Smoothing::smartLaplace(initialMesh, singleIterationConfig);
+
+  EXPECT_EQ(1, result.iterations);
+  EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+}
+
+TEST(LaplaceAlgorithms, smartLaplace_observerCancelled) {
+  const auto initialMesh = Testdata::getMixedSampleMesh();
+  Smoothing::SmartLaplaceConfig config;
+  config.qMeanImprovementThreshold = 0.0;
+  double observedQMean = 0.0;
+  config.observer.callback =
+      [&](const Smoothing::SmoothingProgress& progress) {
+        observedQMean = progress.meshQuality.getQMean();
+        return progress.iteration < 2;
+      };
+  const auto result = Smoothing::smartLaplace(initialMesh, config);
+
+  EXPECT_EQ(2, result.iterations);
+  EXPECT_GT(observedQMean, Mesh::MeshQuality(initialMesh).getQMean());
+}
+
 TEST(LaplaceAlgorithms, smartLaplace_qMeanTerminated) {
   const auto initialMesh = Testdata::getMixedSampleMesh();
   Smoothing::SmartLaplaceConfig config;
@@ -0,0 +1,223 @@
+/*
+Unit tests for the reusable scratch buffers of the smoothing algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Smoothing/smoothing_workspace.h"
+
+#include "Mesh/polygonal_mesh.h"
+#include "Mesh/polygonal_mesh_algorithms.h"
+#include "Smoothing/basic_getme_simultaneous_config.h"
+#include "Smoothing/basic_laplace_config.h"
+#include "Smoothing/default_configuration.h"
+#include "Smoothing/getme_algorithms.h"
+#include "Smoothing/getme_config.h"
+#include "Smoothing/getme_result.h"
+#include "Smoothing/getme_sequential_config.h"
+#include "Smoothing/getme_simultaneous_config.h"
+#include "Smoothing/laplace_algorithms.h"
+#include "Smoothing/smart_laplace_config.h"
+#include "Smoothing/smoothing_result.h"
+#include "Testdata/mesh_generators.h"
+#include "Testdata/meshes.h"
+
+#include "../Source/getme_sequential.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+// Run all smoothing algorithms supporting a workspace with the given
+// workspace.
+std::vector<Smoothing::SmoothingResult> runAllAlgorithms(
+    const Mesh::PolygonalMesh& mesh,
+    Smoothing::SmoothingWorkspace& workspace) {
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  const Smoothing::BasicLaplaceConfig basicLaplaceConfig(
+      maxNodeRelocationDistanceThreshold);
+  const Smoothing::SmartLaplaceConfig smartLaplaceConfig;
+  const Smoothing::BasicGetmeSimultaneousConfig basicGetmeSimultaneousConfig(
+      maxNodeRelocationDistanceThreshold,
+      mesh.getMaximalNumberOfPolygonNodes());
+  const Smoothing::GetmeSimultaneousConfig getmeSimultaneousConfig(
+      mesh.getMaximalNumberOfPolygonNodes());
+  const Smoothing::GetmeSequentialConfig getmeSequentialConfig(
+      mesh.getMaximalNumberOfPolygonNodes());
+  return {
+      Smoothing::basicLaplace(mesh, basicLaplaceConfig, workspace),
+      Smoothing::smartLaplace(mesh, smartLaplaceConfig, workspace),
+      Smoothing::basicGetmeSimultaneous(mesh, basicGetmeSimultaneousConfig,
+                                        workspace),
+      Smoothing::getmeSimultaneous(mesh, getmeSimultaneousConfig, workspace),
+      Smoothing::getmeSequential(mesh, getmeSequentialConfig, workspace)};
+}
+}  // namespace
+
+TEST(SmoothingWorkspace, sameResultsAsWithoutWorkspace) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  Smoothing::SmoothingWorkspace workspace;
+  const auto results = runAllAlgorithms(mesh, workspace);
+
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  const std::vector<Smoothing::SmoothingResult> expectedResults = {
+      Smoothing::basicLaplace(mesh, Smoothing::BasicLaplaceConfig(
+                                        maxNodeRelocationDistanceThreshold)),
+      Smoothing::smartLaplace(mesh, Smoothing::SmartLaplaceConfig()),
+      Smoothing::basicGetmeSimultaneous(
+          mesh, Smoothing::BasicGetmeSimultaneousConfig(
+                    maxNodeRelocationDistanceThreshold,
+                    mesh.getMaximalNumberOfPolygonNodes())),
+      Smoothing::getmeSimultaneous(
+          mesh, Smoothing::GetmeSimultaneousConfig(
+                    mesh.getMaximalNumberOfPolygonNodes())),
+      Smoothing::getmeSequential(
+          mesh, Smoothing::GetmeSequentialConfig(
+                    mesh.getMaximalNumberOfPolygonNodes()))};
+  ASSERT_EQ(expectedResults.size(), results.size());
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    EXPECT_EQ(expectedResults.at(index).iterations,
+              results.at(index).iterations);
+    EXPECT_TRUE(
+        Mesh::areEqual(expectedResults.at(index).mesh, results.at(index).mesh));
+  }
+}
+
+TEST(SmoothingWorkspace, noReallocationAfterWarmUp) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  Smoothing::SmoothingWorkspace workspace(mesh.getNumberOfNodes(),
+                                          mesh.getNumberOfPolygons());
+  const auto reservedCapacity = workspace.getCapacityInBytes();
+  EXPECT_GT(reservedCapacity, 0);
+
+  runAllAlgorithms(mesh, workspace);
+  const auto capacityAfterWarmUp = workspace.getCapacityInBytes();
+  const auto* newNodePositionsData =
+      workspace.getBuffers<double>().newNodePositions.data();
+  const auto* xCoordinatesData =
+      workspace.getCurrentNodeArrays().getXCoordinates().data();
+  const auto* affectedNeighborPolygonIndicesData =
+      workspace.getGetmeSequentialBuffers()
+          .affectedNeighborPolygonIndices.data();
+  runAllAlgorithms(mesh, workspace);
+
+  EXPECT_EQ(capacityAfterWarmUp, workspace.getCapacityInBytes());
+  EXPECT_EQ(newNodePositionsData,
+            workspace.getBuffers<double>().newNodePositions.data());
+  EXPECT_EQ(affectedNeighborPolygonIndicesData,
+            workspace.getGetmeSequentialBuffers()
+                .affectedNeighborPolygonIndices.data());
+  // Node arrays are swapped during basic Laplace smoothing.
+  EXPECT_TRUE(
+      xCoordinatesData
+          == workspace.getCurrentNodeArrays().getXCoordinates().data()
+      || xCoordinatesData
+             == workspace.getNewNodeArrays().getXCoordinates().data());
+}
+
+TEST(SmoothingWorkspace, noReallocationAfterWarmUpInSinglePrecision) {
+  const auto mesh = Testdata::getMixedSampleMesh();
+  const double maxNodeRelocationDistanceThreshold = 0.01;
+  Smoothing::BasicGetmeSimultaneousConfig basicGetmeSimultaneousConfig(
+      maxNodeRelocationDistanceThreshold,
+      mesh.getMaximalNumberOfPolygonNodes());
+  basicGetmeSimultaneousConfig.floatingPointPrecision =
+      Smoothing::DefaultConfiguration::FloatingPointPrecision::Single;
+  Smoothing::GetmeSimultaneousConfig getmeSimultaneousConfig(
+      mesh.getMaximalNumberOfPolygonNodes());
+  getmeSimultaneousConfig.floatingPointPrecision =
+      Smoothing::DefaultConfiguration::FloatingPointPrecision::Single;
+  const auto runSinglePrecisionAlgorithms =
+      [&](Smoothing::SmoothingWorkspace& workspace) {
+        return std::vector<Smoothing::SmoothingResult>{
+            Smoothing::basicGetmeSimultaneous(
+                mesh, basicGetmeSimultaneousConfig, workspace),
+            Smoothing::getmeSimultaneous(mesh, getmeSimultaneousConfig,
+                                         workspace)};
+      };
+  Smoothing::SmoothingWorkspace workspace;
+  const auto expectedResults = runSinglePrecisionAlgorithms(workspace);
+  const auto capacityAfterWarmUp = workspace.getCapacityInBytes();
+  const auto* newNodePositionsData =
+      workspace.getBuffers<float>().newNodePositions.data();
+  const auto* polygonMeanRatioValuesData =
+      workspace.getBuffers<float>().polygonMeanRatioValues.data();
+
+  const auto results = runSinglePrecisionAlgorithms(workspace);
+
+  EXPECT_GT(capacityAfterWarmUp, 0);
+  EXPECT_EQ(capacityAfterWarmUp, workspace.getCapacityInBytes());
+  EXPECT_EQ(newNodePositionsData,
+            workspace.getBuffers<float>().newNodePositions.data());
+  EXPECT_EQ(polygonMeanRatioValuesData,
+            workspace.getBuffers<float>().polygonMeanRatioValues.data());
+  ASSERT_EQ(expectedResults.size(), results.size());
+  for (std::size_t index = 0; index < results.size(); ++index) {
+    EXPECT_EQ(expectedResults.at(index).iterations,
+              results.at(index).iterations);
+    EXPECT_TRUE(
+        Mesh::areEqual(expectedResults.at(index).mesh, results.at(index).mesh));
+  }
+}
+
+TEST(SmoothingWorkspace, getmeSameResultsForConsecutiveMeshes) {
+  // Random polygonal meshes contain octagons, for which the corner cache is
+  // used. The cache of the workspace must be reset for each mesh.
+  Testdata::MeshGeneratorConfig generatorConfig;
+  generatorConfig.numberOfCellsX = 8;
+  generatorConfig.numberOfCellsY = 6;
+  const auto firstMesh = Testdata::generateRandomPolygonalMesh(generatorConfig);
+  generatorConfig.numberOfCellsX = 10;
+  generatorConfig.seed = 2;
+  const auto secondMesh =
+      Testdata::generateRandomPolygonalMesh(generatorConfig);
+  Smoothing::SmoothingWorkspace workspace;
+  for (const auto& mesh :
+       {firstMesh, Testdata::getMixedSampleMesh(), secondMesh}) {
+    const Smoothing::GetmeConfig config(mesh.getMaximalNumberOfPolygonNodes());
+    const auto expectedResult = Smoothing::getme(mesh, config);
+
+    const auto result = Smoothing::getme(mesh, config, workspace);
+
+    EXPECT_EQ(expectedResult.getmeSimultaneousIterations,
+              result.getmeSimultaneousIterations);
+    EXPECT_EQ(expectedResult.getmeSequentialIterations,
+              result.getmeSequentialIterations);
+    EXPECT_TRUE(Mesh::areEqual(expectedResult.mesh, result.mesh));
+  }
+}
+
+TEST(SmoothingWorkspace, getmeNoReallocationAfterWarmUp) {
+  Testdata::MeshGeneratorConfig generatorConfig;
+  generatorConfig.numberOfCellsX = 8;
+  generatorConfig.numberOfCellsY = 6;
+  const auto mesh = Testdata::generateRandomPolygonalMesh(generatorConfig);
+  const Smoothing::GetmeConfig config(mesh.getMaximalNumberOfPolygonNodes());
+  Smoothing::SmoothingWorkspace workspace;
+  Smoothing::getme(mesh, config, workspace);
+  const auto capacityAfterWarmUp = workspace.getCapacityInBytes();
+  const auto& getmeSequentialBuffers = workspace.getGetmeSequentialBuffers();
+  const auto* temporaryNodesData = getmeSequentialBuffers.temporaryNodes.data();
+  ASSERT_TRUE(getmeSequentialBuffers.meanRatioCornerCache);
+
+  const auto result = Smoothing::getme(mesh, config, workspace);
+
+  EXPECT_EQ(capacityAfterWarmUp, workspace.getCapacityInBytes());
+  EXPECT_EQ(capacityAfterWarmUp, result.peakScratchMemoryInBytes);
+  EXPECT_EQ(temporaryNodesData, getmeSequentialBuffers.temporaryNodes.data());
+}
@@ -0,0 +1,85 @@
+/*
+Generators of synthetic polygonal meshes of configurable size.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Synthetic meshes are generated in memory. Hence, benchmarks and tests can use
+// meshes with millions of elements without depending on large mesh files.
+#pragma once
+
+#include "Mesh/polygonal_mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Testdata {
+// Element type of grid meshes.
+enum class GridElementType {
+  // Each grid cell is split into two triangles by its diagonal from the lower
+  // left to the upper right node.
+  Triangle,
+
+  // Each grid cell is a quadrilateral.
+  Quadrilateral,
+};
+
+// Options common to all mesh generators. Meshes are based on a grid of square
+// cells with unit edge length, whose lower left node is the origin.
+struct MeshGeneratorConfig final {
+  // Number of grid cells in x- and y-direction. Must be positive.
+  std::size_t numberOfCellsX = 100;
+  std::size_t numberOfCellsY = 100;
+
+  // Fix all nodes on the mesh boundary including the boundaries of holes.
+  bool fixBoundaryNodes = true;
+
+  // Maximal distance of the random movement of non fixed nodes. No distortion
+  // for zero. Must not be negative. Radii below 0.35 preserve the validity of
+  // grid meshes, larger radii usually result in invalid elements.
+  double maxDistortionRadius = 0.0;
+
+  // Seed of all random numbers. Meshes only depend on the config, not on the
+  // number of threads used.
+  std::uint64_t seed = 1;
+};
+
+// Generate a structured grid mesh. Triangle meshes consist of two elements per
+// grid cell.
+Mesh::PolygonalMesh generateGridMesh(const MeshGeneratorConfig& config,
+                                     const GridElementType elementType);
+
+// Generate a grid mesh perforated by square holes of holeSize x holeSize
+// cells. Holes are centered in the blocks of holeSpacing x holeSpacing cells
+// starting at the origin. Blocks exceeding the grid are not perforated. The
+// hole size must be positive and holes must be surrounded by at least one cell
+// in each direction, i.e., holeSize + 2 <= holeSpacing.
+Mesh::PolygonalMesh generatePerforatedGridMesh(
+    const MeshGeneratorConfig& config,
+    const GridElementType elementType,
+    const std::size_t holeSize,
+    const std::size_t holeSpacing);
+
+// Generate a randomized mixed polygonal mesh resembling a Voronoi tessellation.
+// It is the dual of a triangle grid mesh, whose inner nodes are moved randomly
+// and whose cells are split along randomly chosen diagonals. Each inner grid
+// node yields one polygon, which connects the centroids of the triangles
+// attached to the node. Polygons have four to eight nodes.
+Mesh::PolygonalMesh generateRandomPolygonalMesh(
+    const MeshGeneratorConfig& config);
+}  // namespace Testdata
@@ -45,4 +45,10 @@ Mesh::PolygonalMesh getMixedSampleMesh();
 // Generate invalid mesh by shifting node 9 of the mixed sample mesh to the
 // right of the valid mesh bounding box, which invalidates elements 2 and 3.
 Mesh::PolygonalMesh getInvalidMixedSampleMesh();
+
+// Get a regular grid mesh of 20 x 20 unit squares with fixed boundary nodes,
+// whose node in column 3 and row 3 is shifted by (0.3, 0.2). Since smoothing
+// does not change the regular grid, only the nodes near the shifted node move
+// initially.
+Mesh::PolygonalMesh getLocallyPerturbedGridMesh();
 }  // namespace Testdata
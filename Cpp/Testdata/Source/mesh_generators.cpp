@@ -0,0 +1,347 @@
+/*
+Generators of synthetic polygonal meshes of configurable size.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Testdata/mesh_generators.h"
+
+#include "Mathematics/polygon.h"
+#include "Mathematics/vector2d.h"
+#include "Mathematics/vector2d_algorithms.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Utility/counter_based_random.h"
+#include "Utility/exception_handling.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+// Maximal random movement of the inner grid nodes underlying randomized
+// polygonal meshes. Small enough to preserve the validity of the triangles.
+constexpr double maxGridNodeJitterRadius = 0.2;
+
+// Polygons given by their concatenated node indices to avoid allocations per
+// polygon while generating meshes.
+class PolygonList final {
+public:
+  void add(const std::initializer_list<std::size_t> polygonNodeIndices) {
+    nodeIndices.insert(nodeIndices.end(), polygonNodeIndices);
+    offsets.push_back(nodeIndices.size());
+  }
+
+  void add(const std::span<const std::size_t> polygonNodeIndices) {
+    nodeIndices.insert(nodeIndices.end(), polygonNodeIndices.begin(),
+                       polygonNodeIndices.end());
+    offsets.push_back(nodeIndices.size());
+  }
+
+  std::size_t getNumberOfPolygons() const { return offsets.size() - 1; }
+
+  std::span<const std::size_t> getNodeIndices(
+      const std::size_t polygonIndex) const {
+    return std::span(nodeIndices)
+        .subspan(offsets.at(polygonIndex),
+                 offsets.at(polygonIndex + 1) - offsets.at(polygonIndex));
+  }
+
+  std::vector<std::size_t>& getMutableNodeIndices() { return nodeIndices; }
+
+private:
+  std::vector<std::size_t> nodeIndices;
+  std::vector<std::size_t> offsets{0};
+};
+
+void checkConfig(const Testdata::MeshGeneratorConfig& config) {
+  Utility::throwExceptionIfFalse(
+      config.numberOfCellsX > 0 && config.numberOfCellsY > 0,
+      "Number of cells has to be positive.");
+  Utility::throwExceptionIfFalse(config.maxDistortionRadius >= 0.0,
+                                 "Distortion radius must not be negative.");
+}
+
+// Get the nodes of the grid ordered row by row.
+std::vector<Mathematics::Vector2D> getGridNodes(
+    const Testdata::MeshGeneratorConfig& config) {
+  std::vector<Mathematics::Vector2D> nodes;
+  nodes.reserve((config.numberOfCellsX + 1) * (config.numberOfCellsY + 1));
+  for (std::size_t row = 0; row <= config.numberOfCellsY; ++row) {
+    for (std::size_t column = 0; column <= config.numberOfCellsX; ++column) {
+      nodes.emplace_back(static_cast<double>(column),
+                         static_cast<double>(row));
+    }
+  }
+  return nodes;
+}
+
+// Get the grid node indices of the lower left, lower right, upper right and
+// upper left node of the given cell.
+std::array<std::size_t, 4> getCellNodeIndices(
+    const Testdata::MeshGeneratorConfig& config,
+    const std::size_t row,
+    const std::size_t column) {
+  const std::size_t numberOfNodesPerRow = config.numberOfCellsX + 1;
+  const std::size_t nodeIndex = row * numberOfNodesPerRow + column;
+  return {nodeIndex, nodeIndex + 1, nodeIndex + numberOfNodesPerRow + 1,
+          nodeIndex + numberOfNodesPerRow};
+}
+
+// Add the elements of the given cell. Triangles are split along the diagonal
+// from the lower left to the upper right node if isRisingDiagonal is true and
+// along the other diagonal otherwise.
+void addCellPolygons(const std::array<std::size_t, 4>& cellNodeIndices,
+                     const Testdata::GridElementType elementType,
+                     const bool isRisingDiagonal,
+                     PolygonList& polygons) {
+  const auto [lowerLeft, lowerRight, upperRight, upperLeft] = cellNodeIndices;
+  if (elementType == Testdata::GridElementType::Quadrilateral) {
+    polygons.add({lowerLeft, lowerRight, upperRight, upperLeft});
+  } else if (isRisingDiagonal) {
+    polygons.add({lowerLeft, lowerRight, upperRight});
+    polygons.add({lowerLeft, upperRight, upperLeft});
+  } else {
+    polygons.add({lowerLeft, lowerRight, upperLeft});
+    polygons.add({lowerRight, upperRight, upperLeft});
+  }
+}
+
+// Remove the nodes not contained in any polygon. The order of the remaining
+// nodes is preserved.
+void removeUnusedNodes(std::vector<Mathematics::Vector2D>& nodes,
+                       PolygonList& polygons) {
+  constexpr std::size_t unused = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> newNodeIndices(nodes.size(), unused);
+  for (const auto nodeIndex : polygons.getMutableNodeIndices()) {
+    newNodeIndices.at(nodeIndex) = 0;
+  }
+  std::size_t numberOfUsedNodes = 0;
+  for (std::size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+    if (newNodeIndices.at(nodeIndex) != unused) {
+      newNodeIndices.at(nodeIndex) = numberOfUsedNodes;
+      nodes.at(numberOfUsedNodes) = nodes.at(nodeIndex);
+      ++numberOfUsedNodes;
+    }
+  }
+  nodes.resize(numberOfUsedNodes, Mathematics::Vector2D(0.0, 0.0));
+  for (auto& nodeIndex : polygons.getMutableNodeIndices()) {
+    nodeIndex = newNodeIndices.at(nodeIndex);
+  }
+}
+
+// Get the nodes of the edges contained in exactly one polygon.
+std::unordered_set<std::size_t> getBoundaryNodeIndices(
+    const PolygonList& polygons) {
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+  edges.reserve(polygons.getNumberOfPolygons() * 4);
+  for (std::size_t polygonIndex = 0;
+       polygonIndex < polygons.getNumberOfPolygons(); ++polygonIndex) {
+    const auto nodeIndices = polygons.getNodeIndices(polygonIndex);
+    for (std::size_t nodeNumber = 0; nodeNumber < nodeIndices.size();
+         ++nodeNumber) {
+      const auto nodeIndex = nodeIndices[nodeNumber];
+      const auto successorNodeIndex =
+          nodeIndices[(nodeNumber + 1) % nodeIndices.size()];
+      edges.push_back(std::minmax(nodeIndex, successorNodeIndex));
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  std::unordered_set<std::size_t> boundaryNodeIndices;
+  for (std::size_t edgeIndex = 0; edgeIndex < edges.size();) {
+    std::size_t nextEdgeIndex = edgeIndex + 1;
+    while (nextEdgeIndex < edges.size()
+           && edges.at(nextEdgeIndex) == edges.at(edgeIndex)) {
+      ++nextEdgeIndex;
+    }
+    if (nextEdgeIndex == edgeIndex + 1) {
+      boundaryNodeIndices.insert(edges.at(edgeIndex).first);
+      boundaryNodeIndices.insert(edges.at(edgeIndex).second);
+    }
+    edgeIndex = nextEdgeIndex;
+  }
+  return boundaryNodeIndices;
+}
+
+// Create the mesh of the given nodes and polygons. Removes unused nodes, fixes
+// boundary nodes and distorts non fixed nodes as configured.
+Mesh::PolygonalMesh createMesh(std::vector<Mathematics::Vector2D> nodes,
+                               PolygonList polygons,
+                               const Testdata::MeshGeneratorConfig& config) {
+  removeUnusedNodes(nodes, polygons);
+  std::unordered_set<std::size_t> fixedNodeIndices;
+  if (config.fixBoundaryNodes) {
+    fixedNodeIndices = getBoundaryNodeIndices(polygons);
+  }
+  // Equivalent to seeded local distortion of the mesh, but avoids copying it.
+  if (config.maxDistortionRadius > 0.0) {
+    for (std::size_t nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+      if (!fixedNodeIndices.contains(nodeIndex)) {
+        nodes.at(nodeIndex) += Mathematics::getRandomVector(
+            config.maxDistortionRadius, config.seed, nodeIndex);
+      }
+    }
+  }
+  std::vector<Mathematics::Polygon> meshPolygons;
+  meshPolygons.reserve(polygons.getNumberOfPolygons());
+  for (std::size_t polygonIndex = 0;
+       polygonIndex < polygons.getNumberOfPolygons(); ++polygonIndex) {
+    const auto nodeIndices = polygons.getNodeIndices(polygonIndex);
+    meshPolygons.emplace_back(
+        std::vector<std::size_t>(nodeIndices.begin(), nodeIndices.end()));
+  }
+  return Mesh::PolygonalMesh(nodes, meshPolygons, fixedNodeIndices);
+}
+}  // namespace
+
+namespace Testdata {
+Mesh::PolygonalMesh generateGridMesh(const MeshGeneratorConfig& config,
+                                     const GridElementType elementType) {
+  checkConfig(config);
+  PolygonList polygons;
+  for (std::size_t row = 0; row < config.numberOfCellsY; ++row) {
+    for (std::size_t column = 0; column < config.numberOfCellsX; ++column) {
+      addCellPolygons(getCellNodeIndices(config, row, column), elementType,
+                      true, polygons);
+    }
+  }
+  return createMesh(getGridNodes(config), std::move(polygons), config);
+}
+
+Mesh::PolygonalMesh generatePerforatedGridMesh(
+    const MeshGeneratorConfig& config,
+    const GridElementType elementType,
+    const std::size_t holeSize,
+    const std::size_t holeSpacing) {
+  checkConfig(config);
+  Utility::throwExceptionIfFalse(holeSize > 0 && holeSize + 2 <= holeSpacing,
+                                 "Invalid hole size or spacing.");
+  const std::size_t holeOffset = (holeSpacing - holeSize) / 2;
+  // Check whether the given cell coordinate lies within a hole of a block
+  // contained in the grid.
+  const auto isInHole = [&](const std::size_t coordinate,
+                            const std::size_t numberOfCells) {
+    const std::size_t blockStart = coordinate - coordinate % holeSpacing;
+    const std::size_t coordinateInBlock = coordinate % holeSpacing;
+    return blockStart + holeSpacing <= numberOfCells
+           && coordinateInBlock >= holeOffset
+           && coordinateInBlock < holeOffset + holeSize;
+  };
+  PolygonList polygons;
+  for (std::size_t row = 0; row < config.numberOfCellsY; ++row) {
+    for (std::size_t column = 0; column < config.numberOfCellsX; ++column) {
+      if (isInHole(row, config.numberOfCellsY)
+          && isInHole(column, config.numberOfCellsX)) {
+        continue;
+      }
+      addCellPolygons(getCellNodeIndices(config, row, column), elementType,
+                      true, polygons);
+    }
+  }
+  return createMesh(getGridNodes(config), std::move(polygons), config);
+}
+
+Mesh::PolygonalMesh generateRandomPolygonalMesh(
+    const MeshGeneratorConfig& config) {
+  checkConfig(config);
+  const std::uint64_t jitterSeed = Utility::mixBits(config.seed);
+  const std::uint64_t diagonalSeed = Utility::mixBits(jitterSeed);
+
+  // Triangle grid with randomly moved inner nodes and random diagonals.
+  auto gridNodes = getGridNodes(config);
+  for (std::size_t row = 1; row < config.numberOfCellsY; ++row) {
+    for (std::size_t column = 1; column < config.numberOfCellsX; ++column) {
+      const std::size_t nodeIndex = getCellNodeIndices(config, row, column)[0];
+      gridNodes.at(nodeIndex) += Mathematics::getRandomVector(
+          maxGridNodeJitterRadius, jitterSeed, nodeIndex);
+    }
+  }
+  PolygonList triangles;
+  for (std::size_t row = 0; row < config.numberOfCellsY; ++row) {
+    for (std::size_t column = 0; column < config.numberOfCellsX; ++column) {
+      const std::size_t cellIndex = row * config.numberOfCellsX + column;
+      const bool isRisingDiagonal =
+          (Utility::getRandomBits(diagonalSeed, cellIndex) & 1) == 1;
+      addCellPolygons(getCellNodeIndices(config, row, column),
+                      GridElementType::Triangle, isRisingDiagonal, triangles);
+    }
+  }
+
+  // Triangle centroids are the nodes of the dual mesh.
+  std::vector<Mathematics::Vector2D> centroids;
+  centroids.reserve(triangles.getNumberOfPolygons());
+  // Attached triangles of the grid nodes in compressed row storage.
+  std::vector<std::size_t> attachedTriangleOffsets(gridNodes.size() + 1, 0);
+  for (std::size_t triangleIndex = 0;
+       triangleIndex < triangles.getNumberOfPolygons(); ++triangleIndex) {
+    Mathematics::Vector2D centroid(0.0, 0.0);
+    for (const auto nodeIndex : triangles.getNodeIndices(triangleIndex)) {
+      centroid += gridNodes.at(nodeIndex);
+      ++attachedTriangleOffsets.at(nodeIndex + 1);
+    }
+    centroids.push_back(centroid / 3.0);
+  }
+  for (std::size_t nodeIndex = 0; nodeIndex < gridNodes.size(); ++nodeIndex) {
+    attachedTriangleOffsets.at(nodeIndex + 1) +=
+        attachedTriangleOffsets.at(nodeIndex);
+  }
+  std::vector<std::size_t> attachedTriangleIndices(
+      attachedTriangleOffsets.back());
+  auto insertionOffsets = attachedTriangleOffsets;
+  for (std::size_t triangleIndex = 0;
+       triangleIndex < triangles.getNumberOfPolygons(); ++triangleIndex) {
+    for (const auto nodeIndex : triangles.getNodeIndices(triangleIndex)) {
+      attachedTriangleIndices.at(insertionOffsets.at(nodeIndex)++) =
+          triangleIndex;
+    }
+  }
+
+  // Each inner grid node yields the polygon of the attached triangle centroids
+  // in counterclockwise order.
+  PolygonList polygons;
+  std::vector<std::pair<double, std::size_t>> anglesAndCentroidIndices;
+  std::vector<std::size_t> polygonNodeIndices;
+  for (std::size_t row = 1; row < config.numberOfCellsY; ++row) {
+    for (std::size_t column = 1; column < config.numberOfCellsX; ++column) {
+      const std::size_t nodeIndex = getCellNodeIndices(config, row, column)[0];
+      const auto& node = gridNodes.at(nodeIndex);
+      anglesAndCentroidIndices.clear();
+      for (std::size_t offset = attachedTriangleOffsets.at(nodeIndex);
+           offset < attachedTriangleOffsets.at(nodeIndex + 1); ++offset) {
+        const auto triangleIndex = attachedTriangleIndices.at(offset);
+        const auto direction = centroids.at(triangleIndex) - node;
+        anglesAndCentroidIndices.emplace_back(
+            std::atan2(direction.getY(), direction.getX()), triangleIndex);
+      }
+      std::sort(anglesAndCentroidIndices.begin(),
+                anglesAndCentroidIndices.end());
+      polygonNodeIndices.clear();
+      for (const auto& [angle, centroidIndex] : anglesAndCentroidIndices) {
+        polygonNodeIndices.push_back(centroidIndex);
+      }
+      polygons.add(polygonNodeIndices);
+    }
+  }
+  return createMesh(std::move(centroids), std::move(polygons), config);
+}
+}  // namespace Testdata
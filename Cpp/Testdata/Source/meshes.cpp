@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Testdata/meshes.h"
 
 #include "Mesh/polygonal_mesh.h"
+#include "Testdata/mesh_generators.h"
 
 std::vector<Mathematics::Vector2D> Testdata::getMixedSampleMeshNodes() {
   return std::vector<Mathematics::Vector2D>{
@@ -66,3 +67,13 @@ Mesh::PolygonalMesh Testdata::getInvalidMixedSampleMesh() {
   invalidMesh.getMutableNodes().at(9) = {17.0, 2.0};
   return invalidMesh;
 }
+
+Mesh::PolygonalMesh Testdata::getLocallyPerturbedGridMesh() {
+  MeshGeneratorConfig config;
+  config.numberOfCellsX = 20;
+  config.numberOfCellsY = 20;
+  auto mesh = generateGridMesh(config, GridElementType::Quadrilateral);
+  const std::size_t perturbedNodeIndex = 3 * (config.numberOfCellsX + 1) + 3;
+  mesh.getMutableNodes().at(perturbedNodeIndex) += {0.3, 0.2};
+  return mesh;
+}
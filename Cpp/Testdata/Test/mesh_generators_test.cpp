@@ -0,0 +1,146 @@
+/*
+Unit tests for the generators of synthetic polygonal meshes.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Testdata/mesh_generators.h"
+
+#include "Mesh/mesh_quality.h"
+#include "Mesh/polygonal_mesh.h"
+#include "Mesh/polygonal_mesh_algorithms.h"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <set>
+
+TEST(MeshGenerators, generateGridMesh_quadrilaterals) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 3;
+  config.numberOfCellsY = 2;
+
+  const auto mesh = Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral);
+
+  EXPECT_EQ(12, mesh.getNumberOfNodes());
+  EXPECT_EQ(6, mesh.getNumberOfPolygons());
+  // All nodes except the two inner nodes are boundary nodes.
+  EXPECT_EQ(10, mesh.getFixedNodeIndices().size());
+  EXPECT_FALSE(mesh.getFixedNodeIndices().contains(5));
+  EXPECT_FALSE(mesh.getFixedNodeIndices().contains(6));
+  EXPECT_DOUBLE_EQ(1.0, Mesh::MeshQuality(mesh).getQMin());
+}
+
+TEST(MeshGenerators, generateGridMesh_triangles) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 4;
+  config.numberOfCellsY = 5;
+  config.fixBoundaryNodes = false;
+
+  const auto mesh =
+      Testdata::generateGridMesh(config, Testdata::GridElementType::Triangle);
+
+  EXPECT_EQ(30, mesh.getNumberOfNodes());
+  EXPECT_EQ(40, mesh.getNumberOfPolygons());
+  EXPECT_EQ(3, mesh.getMaximalNumberOfPolygonNodes());
+  EXPECT_TRUE(mesh.getFixedNodeIndices().empty());
+  EXPECT_TRUE(Mesh::MeshQuality(mesh).isValidMesh());
+}
+
+TEST(MeshGenerators, generateGridMesh_distortion) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 20;
+  config.numberOfCellsY = 10;
+  const auto regularMesh = Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral);
+  config.maxDistortionRadius = 0.2;
+  config.seed = 3;
+
+  const auto mesh = Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral);
+
+  // Equivalent to seeded local distortion of the regular mesh.
+  EXPECT_TRUE(Mesh::areEqual(
+      Mesh::distortNodesLocally(regularMesh, config.maxDistortionRadius,
+                                config.seed),
+      mesh));
+  EXPECT_FALSE(Mesh::areEqual(regularMesh, mesh));
+  EXPECT_TRUE(Mesh::MeshQuality(mesh).isValidMesh());
+}
+
+TEST(MeshGenerators, generatePerforatedGridMesh) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 8;
+  config.numberOfCellsY = 9;
+  const std::size_t holeSize = 2;
+  const std::size_t holeSpacing = 4;
+
+  const auto mesh = Testdata::generatePerforatedGridMesh(
+      config, Testdata::GridElementType::Quadrilateral, holeSize, holeSpacing);
+
+  // Four holes of four cells each. The last row of cells is not perforated
+  // since it belongs to a block exceeding the grid. Each hole removes one
+  // node.
+  EXPECT_EQ(56, mesh.getNumberOfPolygons());
+  EXPECT_EQ(86, mesh.getNumberOfNodes());
+  // Outer boundary nodes and eight boundary nodes per hole are fixed.
+  EXPECT_EQ(34 + 4 * 8, mesh.getFixedNodeIndices().size());
+  EXPECT_DOUBLE_EQ(1.0, Mesh::MeshQuality(mesh).getQMin());
+
+  EXPECT_ANY_THROW(Testdata::generatePerforatedGridMesh(
+      config, Testdata::GridElementType::Triangle, 3, 4));
+}
+
+TEST(MeshGenerators, generateRandomPolygonalMesh) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 30;
+  config.numberOfCellsY = 20;
+
+  const auto mesh = Testdata::generateRandomPolygonalMesh(config);
+
+  // One polygon per inner grid node.
+  EXPECT_EQ(29 * 19, mesh.getNumberOfPolygons());
+  std::set<std::size_t> polygonSizes;
+  for (const auto& polygon : mesh.getPolygons()) {
+    polygonSizes.insert(polygon.getNumberOfNodes());
+  }
+  EXPECT_LE(4, *polygonSizes.begin());
+  EXPECT_GE(8, *polygonSizes.rbegin());
+  EXPECT_LE(4, polygonSizes.size());
+  EXPECT_FALSE(mesh.getFixedNodeIndices().empty());
+  EXPECT_FALSE(mesh.getNonFixedNodeIndices().empty());
+  EXPECT_TRUE(Mesh::MeshQuality(mesh).isValidMesh());
+
+  // Reproducible for a given seed.
+  EXPECT_TRUE(
+      Mesh::areEqual(mesh, Testdata::generateRandomPolygonalMesh(config)));
+  config.seed = 2;
+  EXPECT_FALSE(
+      Mesh::areEqual(mesh, Testdata::generateRandomPolygonalMesh(config)));
+}
+
+TEST(MeshGenerators, throwIfInvalidConfig) {
+  Testdata::MeshGeneratorConfig config;
+  config.numberOfCellsX = 0;
+  EXPECT_ANY_THROW(Testdata::generateGridMesh(
+      config, Testdata::GridElementType::Quadrilateral));
+  config.numberOfCellsX = 1;
+  config.maxDistortionRadius = -1.0;
+  EXPECT_ANY_THROW(Testdata::generateRandomPolygonalMesh(config));
+}
@@ -0,0 +1,50 @@
+/*
+Stateless counter based generation of pseudo random numbers.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace Utility {
+// Bijective 64 bit mixing function of the SplitMix64 generator.
+constexpr std::uint64_t mixBits(std::uint64_t value) {
+  value += 0x9e3779b97f4a7c15;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+  return value ^ (value >> 31);
+}
+
+// Get 64 pseudo random bits for the given seed and counter. The result only
+// depends on these two values. Thus, random numbers can be generated in
+// parallel in any order, while results are reproducible for a given seed.
+constexpr std::uint64_t getRandomBits(const std::uint64_t seed,
+                                      const std::uint64_t counter) {
+  return mixBits(mixBits(seed) ^ counter);
+}
+
+// Get a pseudo random number uniformly distributed in [0,1) for the given seed
+// and counter.
+constexpr double getUniformRandomNumber(const std::uint64_t seed,
+                                        const std::uint64_t counter) {
+  // Use the upper 53 bits, i.e. the size of the double mantissa.
+  return static_cast<double>(getRandomBits(seed, counter) >> 11) * 0x1.0p-53;
+}
+}  // namespace Utility
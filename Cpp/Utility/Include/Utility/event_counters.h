@@ -0,0 +1,105 @@
+/*
+Thread local counters of events occurring in hot paths of the algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Counters are only active if GETME_ENABLE_EVENT_COUNTERS is defined, which is
+// controlled by the CMake option of the same name. Otherwise, counting events
+// compiles to nothing.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Utility {
+#ifdef GETME_ENABLE_EVENT_COUNTERS
+inline constexpr bool areEventCountersEnabled = true;
+#else
+inline constexpr bool areEventCountersEnabled = false;
+#endif
+
+// Counted events. Events are counted where they occur, i.e. in the
+// Mathematics, Mesh and Smoothing modules.
+enum class Event : std::size_t {
+  // Evaluation of the mean ratio quality number of a polygon.
+  MeanRatioEvaluation,
+  // Mean ratio evaluation based on cached corner summands.
+  CachedMeanRatioEvaluation,
+  // Generalized polygon transformation of a polygon.
+  PolygonTransformation,
+  // Reset of a node to its old position to preserve mesh validity.
+  NodeReset,
+  // Swap of two entries while restoring the polygon quality min heap order.
+  HeapSiftStep,
+  // GETMe sequential step rejected due to invalid elements.
+  RejectedSequentialStep,
+  // GETMe sequential selection of the previously transformed polygon.
+  RepeatedSelection
+};
+
+inline constexpr std::size_t numberOfEvents = 7;
+
+std::string_view getEventName(const Event event);
+
+// Counts of all events.
+class EventCounts final {
+public:
+  std::uint64_t get(const Event event) const {
+    return counts.at(static_cast<std::size_t>(event));
+  }
+
+  void add(const Event event, const std::uint64_t count) {
+    counts.at(static_cast<std::size_t>(event)) += count;
+  }
+
+  bool isZero() const;
+
+  EventCounts& operator+=(const EventCounts& other);
+
+  EventCounts operator+(const EventCounts& other) const {
+    EventCounts sum = *this;
+    sum += other;
+    return sum;
+  }
+
+  // Counts since the given earlier counts.
+  EventCounts operator-(const EventCounts& earlierCounts) const;
+
+private:
+  std::array<std::uint64_t, numberOfEvents> counts{};
+};
+
+// Add the given count to the counter of the calling thread. Only the calling
+// thread writes to its counters, hence no synchronization is required.
+void addToThreadEventCount(const Event event, const std::uint64_t count);
+
+// Count the given event. Does nothing if event counters are disabled.
+inline void countEvent(const Event event, const std::uint64_t count = 1) {
+  if constexpr (areEventCountersEnabled) {
+    addToThreadEventCount(event, count);
+  }
+}
+
+// Aggregate the event counts of all threads including terminated threads.
+// Counts of running threads might be incomplete. Returns zero counts if event
+// counters are disabled.
+EventCounts getEventCounts();
+}  // namespace Utility
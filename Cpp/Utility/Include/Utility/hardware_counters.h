@@ -0,0 +1,97 @@
+/*
+Hardware performance counters of the calling thread.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Counters are read using the Linux perf_event_open interface and only count
+// events in user space. They are frequently unavailable, e.g. in containers,
+// virtual machines, on other platforms or due to a restrictive
+// perf_event_paranoid setting. Unavailable counters have no value instead of
+// raising an error, which allows using them unconditionally.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace Utility {
+enum class HardwareCounter : std::size_t {
+  Cycles,
+  Instructions,
+  CacheMisses,
+  BranchMisses
+};
+
+inline constexpr std::size_t numberOfHardwareCounters = 4;
+
+std::string_view getHardwareCounterName(const HardwareCounter counter);
+
+// Values of all hardware counters. Unavailable counters have no value.
+class HardwareCounterValues final {
+public:
+  const std::optional<std::uint64_t>& get(
+      const HardwareCounter counter) const {
+    return values.at(static_cast<std::size_t>(counter));
+  }
+
+  void set(const HardwareCounter counter,
+           const std::optional<std::uint64_t> value) {
+    values.at(static_cast<std::size_t>(counter)) = value;
+  }
+
+  // True if no counter has a value.
+  bool isEmpty() const;
+
+  // Sums have a value only if both summands have a value.
+  HardwareCounterValues& operator+=(const HardwareCounterValues& other);
+
+  // Values since the given earlier values. Differences have a value only if
+  // both values are available.
+  HardwareCounterValues operator-(
+      const HardwareCounterValues& earlierValues) const;
+
+private:
+  std::array<std::optional<std::uint64_t>, numberOfHardwareCounters> values{};
+};
+
+// Counts hardware events of the calling thread during its lifetime. Events of
+// other threads, e.g. the worker threads of parallel loops, are not counted.
+class HardwareCounters final {
+public:
+  HardwareCounters();
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+  ~HardwareCounters();
+
+  // True if at least one counter is available.
+  bool isAvailable() const;
+
+  // Values counted since construction. Values of counters which have been
+  // multiplexed with other events are scaled to the total running time.
+  HardwareCounterValues read() const;
+
+private:
+  std::array<int, numberOfHardwareCounters> fileDescriptors{};
+};
+
+// Hardware counters of the calling thread, which are created on first use.
+const HardwareCounters& getThreadHardwareCounters();
+}  // namespace Utility
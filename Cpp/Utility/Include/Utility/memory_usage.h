@@ -0,0 +1,89 @@
+/*
+Heap memory usage of standard containers.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Memory usage is estimated from container sizes and capacities. Allocator
+// bookkeeping is not included and the node layout of hash sets is assumed to
+// be a successor pointer followed by the value as used by libstdc++.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+namespace Utility {
+// Heap memory of a data structure in bytes. The payload is the memory needed
+// for the stored values. The remaining memory is overhead, e.g. for unused
+// capacity, hash buckets and node pointers.
+struct MemoryUsage final {
+  std::size_t bytes = 0;
+  std::size_t payloadBytes = 0;
+
+  std::size_t getOverheadBytes() const { return bytes - payloadBytes; }
+
+  MemoryUsage& operator+=(const MemoryUsage& other) {
+    bytes += other.bytes;
+    payloadBytes += other.payloadBytes;
+    return *this;
+  }
+
+  MemoryUsage operator+(const MemoryUsage& other) const {
+    MemoryUsage sum = *this;
+    sum += other;
+    return sum;
+  }
+};
+
+template <typename T, typename Allocator>
+MemoryUsage getMemoryUsage(const std::vector<T, Allocator>& vector) {
+  return {vector.capacity() * sizeof(T), vector.size() * sizeof(T)};
+}
+
+// Bits are packed into words, hence one bit per value is payload.
+inline MemoryUsage getMemoryUsage(const std::vector<bool>& vector) {
+  const auto getBytes = [](const std::size_t numberOfBits) {
+    return (numberOfBits + 7) / 8;
+  };
+  return {getBytes(vector.capacity()), getBytes(vector.size())};
+}
+
+template <typename T>
+MemoryUsage getMemoryUsage(const std::unordered_set<T>& set) {
+  constexpr std::size_t nodeAlignment = std::max(alignof(void*), alignof(T));
+  constexpr std::size_t nodeBytes =
+      (sizeof(void*) + sizeof(T) + nodeAlignment - 1) / nodeAlignment
+      * nodeAlignment;
+  // A single bucket is stored within the set object itself.
+  const std::size_t bucketBytes =
+      set.bucket_count() > 1 ? set.bucket_count() * sizeof(void*) : 0;
+  return {bucketBytes + set.size() * nodeBytes, set.size() * sizeof(T)};
+}
+
+// Set objects are overhead, only the values stored in the sets are payload.
+template <typename T>
+MemoryUsage getMemoryUsage(const std::vector<std::unordered_set<T>>& sets) {
+  MemoryUsage memoryUsage{sets.capacity() * sizeof(std::unordered_set<T>), 0};
+  for (const auto& set : sets) {
+    memoryUsage += getMemoryUsage(set);
+  }
+  return memoryUsage;
+}
+}  // namespace Utility
@@ -0,0 +1,149 @@
+/*
+Scoped timers accumulating the wall clock time of named phases.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Timers are only active if GETME_ENABLE_PHASE_TIMERS is defined, which is
+// controlled by the CMake option of the same name. Otherwise, scoped timers
+// compile to nothing. If GETME_ENABLE_PHASE_HARDWARE_COUNTERS is defined as
+// well, scoped timers additionally record the hardware counter values of the
+// calling thread. Reading the counters involves system calls, which distorts
+// the times of very short phases.
+#pragma once
+
+#include "Utility/hardware_counters.h"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Utility {
+#ifdef GETME_ENABLE_PHASE_TIMERS
+inline constexpr bool arePhaseTimersEnabled = true;
+#else
+inline constexpr bool arePhaseTimersEnabled = false;
+#endif
+
+#if defined(GETME_ENABLE_PHASE_TIMERS) \
+    && defined(GETME_ENABLE_PHASE_HARDWARE_COUNTERS)
+inline constexpr bool arePhaseHardwareCountersEnabled = true;
+#else
+inline constexpr bool arePhaseHardwareCountersEnabled = false;
+#endif
+
+// Phase of a PhaseTimes instance, whose index is determined when the phase is
+// added first. Further additions access the phase by its index instead of
+// searching it by name, which matters for phases timed in hot loops. A slot
+// must only be used with a single PhaseTimes instance.
+struct PhaseSlot final {
+  explicit PhaseSlot(const std::string_view name) : name(name) {}
+
+  std::string_view name;
+  std::optional<std::size_t> index;
+};
+
+// Accumulated wall clock times and hardware counter values of named phases in
+// order of their first occurrence.
+class PhaseTimes final {
+public:
+  struct Phase final {
+    std::string name;
+    double timeInSeconds = 0.0;
+    HardwareCounterValues hardwareCounterValues;
+  };
+
+  // Add the given time and hardware counter values to the phase with the
+  // given name. Returns the index of the phase.
+  std::size_t add(const std::string_view phaseName,
+                  const double timeInSeconds,
+                  const HardwareCounterValues& hardwareCounterValues = {});
+
+  // Add the given time and hardware counter values to the phase of the given
+  // slot.
+  void add(PhaseSlot& phaseSlot,
+           const double timeInSeconds,
+           const HardwareCounterValues& hardwareCounterValues = {});
+
+  // Add all phase times of the given phase times. Phase names are prefixed by
+  // the given prefix.
+  void add(const PhaseTimes& phaseTimes, const std::string_view prefix);
+
+  const std::vector<Phase>& getPhases() const { return phases; }
+
+  bool isEmpty() const { return phases.empty(); }
+
+private:
+  std::vector<Phase> phases;
+};
+
+// Adds the wall clock time of its lifetime to the given phase. Hardware counter
+// values are added if phase hardware counters are enabled. Does nothing if
+// phase timers are disabled.
+class ScopedPhaseTimer final {
+public:
+  ScopedPhaseTimer(PhaseTimes& phaseTimes, const std::string_view phaseName)
+    : phaseTimes(phaseTimes), phaseName(phaseName) {
+    start();
+  }
+
+  ScopedPhaseTimer(PhaseTimes& phaseTimes, PhaseSlot& phaseSlot)
+    : phaseTimes(phaseTimes), phaseSlot(&phaseSlot) {
+    start();
+  }
+
+  ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+  ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+  ~ScopedPhaseTimer() {
+    if constexpr (arePhaseTimersEnabled) {
+      const std::chrono::duration<double> elapsedTime =
+          std::chrono::steady_clock::now() - startTimePoint;
+      HardwareCounterValues hardwareCounterValues;
+      if constexpr (arePhaseHardwareCountersEnabled) {
+        hardwareCounterValues =
+            getThreadHardwareCounters().read() - startHardwareCounterValues;
+      }
+      if (phaseSlot) {
+        phaseTimes.add(*phaseSlot, elapsedTime.count(), hardwareCounterValues);
+      } else {
+        phaseTimes.add(phaseName, elapsedTime.count(), hardwareCounterValues);
+      }
+    }
+  }
+
+private:
+  void start() {
+    if constexpr (arePhaseHardwareCountersEnabled) {
+      startHardwareCounterValues = getThreadHardwareCounters().read();
+    }
+    if constexpr (arePhaseTimersEnabled) {
+      startTimePoint = std::chrono::steady_clock::now();
+    }
+  }
+
+  PhaseTimes& phaseTimes;
+  std::string_view phaseName;
+  PhaseSlot* phaseSlot = nullptr;
+  std::chrono::time_point<std::chrono::steady_clock> startTimePoint;
+  HardwareCounterValues startHardwareCounterValues;
+};
+}  // namespace Utility
@@ -0,0 +1,95 @@
+/*
+Scoped tracing of named spans written in the Chrome trace event format.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+// Spans are only recorded if GETME_ENABLE_TRACING is defined, which is
+// controlled by the CMake option of the same name, and tracing has been
+// started. Otherwise, scoped trace spans compile to nothing. Written traces
+// can be inspected with Perfetto or chrome://tracing.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Utility {
+#ifdef GETME_ENABLE_TRACING
+inline constexpr bool isTracingEnabled = true;
+#else
+inline constexpr bool isTracingEnabled = false;
+#endif
+
+using TraceClock = std::chrono::steady_clock;
+
+// Start recording spans. Previously recorded spans are discarded. Must not be
+// called while other threads record spans.
+void startTracing();
+
+// Stop recording spans. Spans ending afterwards are discarded.
+void stopTracing();
+
+// Set the name of the calling thread shown in the trace.
+void setTraceThreadName(const std::string& threadName);
+
+// Record a span of the calling thread in its own buffer, which requires no
+// synchronization. The name has to refer to a string with static storage
+// duration, e.g. a string literal. The index, e.g. an iteration number, is
+// added as span argument if given.
+void recordTraceSpan(const std::string_view name,
+                     const TraceClock::time_point& beginTimePoint,
+                     const TraceClock::time_point& endTimePoint,
+                     const std::optional<std::size_t>& index);
+
+// Write the spans of all threads recorded since tracing has been started as
+// Chrome trace event JSON file. Must not be called while other threads record
+// spans.
+void writeChromeTrace(const std::filesystem::path& outfilePath);
+
+// Records its lifetime as span of the calling thread. Does nothing if tracing
+// is disabled.
+class ScopedTraceSpan final {
+public:
+  explicit ScopedTraceSpan(
+      const std::string_view name,
+      const std::optional<std::size_t>& index = std::nullopt)
+    : name(name), index(index) {
+    if constexpr (isTracingEnabled) {
+      beginTimePoint = TraceClock::now();
+    }
+  }
+
+  ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+  ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+
+  ~ScopedTraceSpan() {
+    if constexpr (isTracingEnabled) {
+      recordTraceSpan(name, beginTimePoint, TraceClock::now(), index);
+    }
+  }
+
+private:
+  std::string_view name;
+  std::optional<std::size_t> index;
+  TraceClock::time_point beginTimePoint;
+};
+}  // namespace Utility
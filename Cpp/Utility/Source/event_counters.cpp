@@ -0,0 +1,141 @@
+/*
+Thread local counters of events occurring in hot paths of the algorithms.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/event_counters.h"
+
+#include "Utility/exception_handling.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+// Counters of a single thread. Written by the owning thread only, but read by
+// other threads during aggregation. Relaxed atomics avoid data races without
+// the costs of read-modify-write operations.
+struct ThreadEventCounters final {
+  ThreadEventCounters();
+  ThreadEventCounters(const ThreadEventCounters&) = delete;
+  ThreadEventCounters& operator=(const ThreadEventCounters&) = delete;
+  ~ThreadEventCounters();
+
+  Utility::EventCounts getCounts() const {
+    Utility::EventCounts eventCounts;
+    for (std::size_t eventIndex = 0; eventIndex < Utility::numberOfEvents;
+         ++eventIndex) {
+      eventCounts.add(static_cast<Utility::Event>(eventIndex),
+                      counts.at(eventIndex).load(std::memory_order_relaxed));
+    }
+    return eventCounts;
+  }
+
+  std::array<std::atomic<std::uint64_t>, Utility::numberOfEvents> counts{};
+};
+
+// Counters of all running threads and the counts of terminated threads.
+struct EventCounterRegistry final {
+  std::mutex mutex;
+  std::vector<const ThreadEventCounters*> threadCounters;
+  Utility::EventCounts terminatedThreadCounts;
+};
+
+EventCounterRegistry& getRegistry() {
+  static EventCounterRegistry registry;
+  return registry;
+}
+
+ThreadEventCounters::ThreadEventCounters() {
+  auto& registry = getRegistry();
+  const std::lock_guard lock(registry.mutex);
+  registry.threadCounters.push_back(this);
+}
+
+ThreadEventCounters::~ThreadEventCounters() {
+  auto& registry = getRegistry();
+  const std::lock_guard lock(registry.mutex);
+  registry.terminatedThreadCounts += getCounts();
+  std::erase(registry.threadCounters, this);
+}
+
+thread_local ThreadEventCounters threadEventCounters;
+}  // namespace
+
+namespace Utility {
+std::string_view getEventName(const Event event) {
+  switch (event) {
+    case Event::MeanRatioEvaluation:
+      return "mean ratio evaluations";
+    case Event::CachedMeanRatioEvaluation:
+      return "cached mean ratio evaluations";
+    case Event::PolygonTransformation:
+      return "polygon transformations";
+    case Event::NodeReset:
+      return "node resets";
+    case Event::HeapSiftStep:
+      return "heap sift steps";
+    case Event::RejectedSequentialStep:
+      return "rejected sequential steps";
+    case Event::RepeatedSelection:
+      return "repeated selections";
+  }
+  throwException("Unknown event.");
+}
+
+bool EventCounts::isZero() const {
+  return std::all_of(counts.begin(), counts.end(),
+                     [](const std::uint64_t count) { return count == 0; });
+}
+
+EventCounts& EventCounts::operator+=(const EventCounts& other) {
+  for (std::size_t eventIndex = 0; eventIndex < numberOfEvents; ++eventIndex) {
+    counts.at(eventIndex) += other.counts.at(eventIndex);
+  }
+  return *this;
+}
+
+EventCounts EventCounts::operator-(const EventCounts& earlierCounts) const {
+  EventCounts difference = *this;
+  for (std::size_t eventIndex = 0; eventIndex < numberOfEvents; ++eventIndex) {
+    difference.counts.at(eventIndex) -= earlierCounts.counts.at(eventIndex);
+  }
+  return difference;
+}
+
+void addToThreadEventCount(const Event event, const std::uint64_t count) {
+  auto& counter = threadEventCounters.counts[static_cast<std::size_t>(event)];
+  counter.store(counter.load(std::memory_order_relaxed) + count,
+                std::memory_order_relaxed);
+}
+
+EventCounts getEventCounts() {
+  if constexpr (!areEventCountersEnabled) {
+    return {};
+  }
+  auto& registry = getRegistry();
+  const std::lock_guard lock(registry.mutex);
+  auto eventCounts = registry.terminatedThreadCounts;
+  for (const auto* threadCounters : registry.threadCounters) {
+    eventCounts += threadCounters->getCounts();
+  }
+  return eventCounts;
+}
+}  // namespace Utility
@@ -0,0 +1,199 @@
+/*
+Hardware performance counters of the calling thread.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/hardware_counters.h"
+
+#include "Utility/exception_handling.h"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr int unavailableFileDescriptor = -1;
+
+#ifdef __linux__
+std::uint64_t getPerfEventConfig(const Utility::HardwareCounter counter) {
+  switch (counter) {
+    case Utility::HardwareCounter::Cycles:
+      return PERF_COUNT_HW_CPU_CYCLES;
+    case Utility::HardwareCounter::Instructions:
+      return PERF_COUNT_HW_INSTRUCTIONS;
+    case Utility::HardwareCounter::CacheMisses:
+      return PERF_COUNT_HW_CACHE_MISSES;
+    case Utility::HardwareCounter::BranchMisses:
+      return PERF_COUNT_HW_BRANCH_MISSES;
+  }
+  Utility::throwException("Unknown hardware counter.");
+}
+
+// Open and start the given counter for the calling thread. Returns
+// unavailableFileDescriptor if the counter cannot be opened.
+int openCounter(const Utility::HardwareCounter counter) {
+  perf_event_attr attributes{};
+  attributes.size = sizeof(attributes);
+  attributes.type = PERF_TYPE_HARDWARE;
+  attributes.config = getPerfEventConfig(counter);
+  attributes.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  const auto fileDescriptor =
+      static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1,
+                               PERF_FLAG_FD_CLOEXEC));
+  if (fileDescriptor < 0) {
+    return unavailableFileDescriptor;
+  }
+  if (ioctl(fileDescriptor, PERF_EVENT_IOC_RESET, 0) != 0
+      || ioctl(fileDescriptor, PERF_EVENT_IOC_ENABLE, 0) != 0) {
+    close(fileDescriptor);
+    return unavailableFileDescriptor;
+  }
+  return fileDescriptor;
+}
+
+std::optional<std::uint64_t> readCounter(const int fileDescriptor) {
+  // Layout given by the read format of openCounter.
+  struct {
+    std::uint64_t value;
+    std::uint64_t timeEnabled;
+    std::uint64_t timeRunning;
+  } data{};
+  if (::read(fileDescriptor, &data, sizeof(data))
+          != static_cast<ssize_t>(sizeof(data))
+      || data.timeRunning == 0) {
+    return std::nullopt;
+  }
+  if (data.timeRunning == data.timeEnabled) {
+    return data.value;
+  }
+  return static_cast<std::uint64_t>(static_cast<double>(data.value)
+                                    * static_cast<double>(data.timeEnabled)
+                                    / static_cast<double>(data.timeRunning));
+}
+#endif
+}  // namespace
+
+namespace Utility {
+std::string_view getHardwareCounterName(const HardwareCounter counter) {
+  switch (counter) {
+    case HardwareCounter::Cycles:
+      return "cycles";
+    case HardwareCounter::Instructions:
+      return "instructions";
+    case HardwareCounter::CacheMisses:
+      return "cache misses";
+    case HardwareCounter::BranchMisses:
+      return "branch misses";
+  }
+  throwException("Unknown hardware counter.");
+}
+
+bool HardwareCounterValues::isEmpty() const {
+  return std::none_of(values.begin(), values.end(),
+                      [](const auto& value) { return value.has_value(); });
+}
+
+HardwareCounterValues& HardwareCounterValues::operator+=(
+    const HardwareCounterValues& other) {
+  for (std::size_t counterIndex = 0; counterIndex < numberOfHardwareCounters;
+       ++counterIndex) {
+    auto& value = values.at(counterIndex);
+    const auto& otherValue = other.values.at(counterIndex);
+    if (value.has_value() && otherValue.has_value()) {
+      value.value() += otherValue.value();
+    } else {
+      value.reset();
+    }
+  }
+  return *this;
+}
+
+HardwareCounterValues HardwareCounterValues::operator-(
+    const HardwareCounterValues& earlierValues) const {
+  HardwareCounterValues difference = *this;
+  for (std::size_t counterIndex = 0; counterIndex < numberOfHardwareCounters;
+       ++counterIndex) {
+    auto& value = difference.values.at(counterIndex);
+    const auto& earlierValue = earlierValues.values.at(counterIndex);
+    if (value.has_value() && earlierValue.has_value()) {
+      value.value() -= earlierValue.value();
+    } else {
+      value.reset();
+    }
+  }
+  return difference;
+}
+
+HardwareCounters::HardwareCounters() {
+  fileDescriptors.fill(unavailableFileDescriptor);
+#ifdef __linux__
+  for (std::size_t counterIndex = 0; counterIndex < numberOfHardwareCounters;
+       ++counterIndex) {
+    fileDescriptors.at(counterIndex) =
+        openCounter(static_cast<HardwareCounter>(counterIndex));
+  }
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+  for (const auto fileDescriptor : fileDescriptors) {
+    if (fileDescriptor != unavailableFileDescriptor) {
+      close(fileDescriptor);
+    }
+  }
+#endif
+}
+
+bool HardwareCounters::isAvailable() const {
+  return std::any_of(fileDescriptors.begin(), fileDescriptors.end(),
+                     [](const int fileDescriptor) {
+                       return fileDescriptor != unavailableFileDescriptor;
+                     });
+}
+
+HardwareCounterValues HardwareCounters::read() const {
+  HardwareCounterValues values;
+#ifdef __linux__
+  for (std::size_t counterIndex = 0; counterIndex < numberOfHardwareCounters;
+       ++counterIndex) {
+    const auto fileDescriptor = fileDescriptors.at(counterIndex);
+    if (fileDescriptor != unavailableFileDescriptor) {
+      values.set(static_cast<HardwareCounter>(counterIndex),
+                 readCounter(fileDescriptor));
+    }
+  }
+#endif
+  return values;
+}
+
+const HardwareCounters& getThreadHardwareCounters() {
+  thread_local const HardwareCounters threadHardwareCounters;
+  return threadHardwareCounters;
+}
+}  // namespace Utility
@@ -0,0 +1,65 @@
+/*
+Scoped timers accumulating the wall clock time of named phases.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/phase_timer.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace Utility {
+std::size_t PhaseTimes::add(
+    const std::string_view phaseName,
+    const double timeInSeconds,
+    const HardwareCounterValues& hardwareCounterValues) {
+  const auto phase =
+      std::find_if(phases.begin(), phases.end(), [&](const Phase& entry) {
+        return entry.name == phaseName;
+      });
+  if (phase == phases.end()) {
+    phases.push_back(
+        {std::string(phaseName), timeInSeconds, hardwareCounterValues});
+    return phases.size() - 1;
+  }
+  phase->timeInSeconds += timeInSeconds;
+  phase->hardwareCounterValues += hardwareCounterValues;
+  return static_cast<std::size_t>(std::distance(phases.begin(), phase));
+}
+
+void PhaseTimes::add(PhaseSlot& phaseSlot,
+                     const double timeInSeconds,
+                     const HardwareCounterValues& hardwareCounterValues) {
+  if (!phaseSlot.index) {
+    phaseSlot.index = add(phaseSlot.name, timeInSeconds, hardwareCounterValues);
+    return;
+  }
+  auto& phase = phases.at(*phaseSlot.index);
+  phase.timeInSeconds += timeInSeconds;
+  phase.hardwareCounterValues += hardwareCounterValues;
+}
+
+void PhaseTimes::add(const PhaseTimes& phaseTimes,
+                     const std::string_view prefix) {
+  for (const auto& phase : phaseTimes.getPhases()) {
+    add(std::string(prefix) + phase.name, phase.timeInSeconds,
+        phase.hardwareCounterValues);
+  }
+}
+}  // namespace Utility
@@ -0,0 +1,163 @@
+/*
+Scoped tracing of named spans written in the Chrome trace event format.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/tracing.h"
+
+#include "Utility/exception_handling.h"
+
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+struct TraceSpan final {
+  std::string_view name;
+  Utility::TraceClock::time_point beginTimePoint;
+  Utility::TraceClock::time_point endTimePoint;
+  std::optional<std::size_t> index;
+};
+
+// Spans of a single thread. Only written by the owning thread. A deque never
+// relocates recorded spans, which keeps the recording costs constant.
+struct ThreadTraceBuffer final {
+  std::size_t threadNumber = 0;
+  std::string threadName;
+  std::deque<TraceSpan> spans;
+};
+
+// Buffers of all threads, which have recorded spans. Buffers are kept after
+// their threads have terminated. The mutex only guards buffer registration,
+// which happens once per thread.
+struct TraceRegistry final {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadTraceBuffer>> threadBuffers;
+  Utility::TraceClock::time_point startTimePoint;
+  std::atomic<bool> isTracingActive = false;
+};
+
+TraceRegistry& getRegistry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+ThreadTraceBuffer& getThreadTraceBuffer() {
+  thread_local ThreadTraceBuffer* threadBuffer = nullptr;
+  if (threadBuffer == nullptr) {
+    auto& registry = getRegistry();
+    const std::lock_guard lock(registry.mutex);
+    auto& newBuffer = registry.threadBuffers.emplace_back(
+        std::make_unique<ThreadTraceBuffer>());
+    newBuffer->threadNumber = registry.threadBuffers.size();
+    newBuffer->threadName = "thread " + std::to_string(newBuffer->threadNumber);
+    threadBuffer = newBuffer.get();
+  }
+  return *threadBuffer;
+}
+
+void writeJsonString(const std::string_view string,
+                     std::ostream& outputStream) {
+  outputStream << '"';
+  for (const char character : string) {
+    if (character == '"' || character == '\\') {
+      outputStream << '\\';
+    }
+    outputStream << character;
+  }
+  outputStream << '"';
+}
+
+// Convert the given duration to microseconds, which is the trace time unit.
+double getTraceTime(const Utility::TraceClock::duration& duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+}  // namespace
+
+namespace Utility {
+void startTracing() {
+  auto& registry = getRegistry();
+  const std::lock_guard lock(registry.mutex);
+  for (auto& threadBuffer : registry.threadBuffers) {
+    threadBuffer->spans.clear();
+  }
+  registry.startTimePoint = TraceClock::now();
+  registry.isTracingActive.store(true, std::memory_order_relaxed);
+}
+
+void stopTracing() {
+  getRegistry().isTracingActive.store(false, std::memory_order_relaxed);
+}
+
+void setTraceThreadName(const std::string& threadName) {
+  getThreadTraceBuffer().threadName = threadName;
+}
+
+void recordTraceSpan(const std::string_view name,
+                     const TraceClock::time_point& beginTimePoint,
+                     const TraceClock::time_point& endTimePoint,
+                     const std::optional<std::size_t>& index) {
+  if (getRegistry().isTracingActive.load(std::memory_order_relaxed)) {
+    getThreadTraceBuffer().spans.push_back(
+        {name, beginTimePoint, endTimePoint, index});
+  }
+}
+
+void writeChromeTrace(const std::filesystem::path& outfilePath) {
+  throwExceptionIfFalse(outfilePath.has_filename(),
+                        "No filename in outfile path given.");
+  auto& registry = getRegistry();
+  const std::lock_guard lock(registry.mutex);
+  std::ofstream outfile(outfilePath);
+  throwExceptionIfFalse(outfile.good(),
+                        "Could not open " + outfilePath.string() + ".");
+  outfile << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+  bool isFirstEvent = true;
+  const auto startNextEvent = [&]() {
+    outfile << (isFirstEvent ? "\n" : ",\n");
+    isFirstEvent = false;
+  };
+  for (const auto& threadBuffer : registry.threadBuffers) {
+    startNextEvent();
+    outfile << R"({"name":"thread_name","ph":"M","pid":1,"tid":)"
+            << threadBuffer->threadNumber << R"(,"args":{"name":)";
+    writeJsonString(threadBuffer->threadName, outfile);
+    outfile << "}}";
+    for (const auto& span : threadBuffer->spans) {
+      startNextEvent();
+      outfile << R"({"name":)";
+      writeJsonString(span.name, outfile);
+      outfile << R"(,"ph":"X","ts":)"
+              << getTraceTime(span.beginTimePoint - registry.startTimePoint)
+              << R"(,"dur":)"
+              << getTraceTime(span.endTimePoint - span.beginTimePoint)
+              << R"(,"pid":1,"tid":)" << threadBuffer->threadNumber;
+      if (span.index.has_value()) {
+        outfile << R"(,"args":{"index":)" << span.index.value() << "}";
+      }
+      outfile << "}";
+    }
+  }
+  outfile << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+}  // namespace Utility
@@ -0,0 +1,55 @@
+/*
+Unit tests for counter based pseudo random number generation.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/counter_based_random.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <unordered_set>
+
+TEST(CounterBasedRandom, getRandomBits) {
+  const std::uint64_t seed = 42;
+  EXPECT_EQ(Utility::getRandomBits(seed, 7), Utility::getRandomBits(seed, 7));
+  EXPECT_NE(Utility::getRandomBits(seed, 7), Utility::getRandomBits(seed, 8));
+  EXPECT_NE(Utility::getRandomBits(seed, 7),
+            Utility::getRandomBits(seed + 1, 7));
+
+  std::unordered_set<std::uint64_t> randomBits;
+  const std::uint64_t numberOfCounters = 10'000;
+  for (std::uint64_t counter = 0; counter < numberOfCounters; ++counter) {
+    randomBits.insert(Utility::getRandomBits(seed, counter));
+  }
+  EXPECT_EQ(numberOfCounters, randomBits.size());
+}
+
+TEST(CounterBasedRandom, getUniformRandomNumber) {
+  const std::uint64_t seed = 1234;
+  const std::uint64_t numberOfCounters = 10'000;
+  double sum = 0.0;
+  for (std::uint64_t counter = 0; counter < numberOfCounters; ++counter) {
+    const double randomNumber = Utility::getUniformRandomNumber(seed, counter);
+    EXPECT_GE(randomNumber, 0.0);
+    EXPECT_LT(randomNumber, 1.0);
+    sum += randomNumber;
+  }
+  EXPECT_NEAR(0.5, sum / static_cast<double>(numberOfCounters), 0.01);
+}
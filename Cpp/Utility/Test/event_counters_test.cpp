@@ -0,0 +1,78 @@
+/*
+Unit tests for thread local event counters.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/event_counters.h"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <set>
+#include <string_view>
+#include <thread>
+
+TEST(EventCounts, arithmetic) {
+  Utility::EventCounts first;
+  EXPECT_TRUE(first.isZero());
+  first.add(Utility::Event::NodeReset, 3);
+  first.add(Utility::Event::HeapSiftStep, 5);
+  EXPECT_FALSE(first.isZero());
+  Utility::EventCounts second;
+  second.add(Utility::Event::NodeReset, 2);
+
+  const auto sum = first + second;
+  EXPECT_EQ(5, sum.get(Utility::Event::NodeReset));
+  EXPECT_EQ(5, sum.get(Utility::Event::HeapSiftStep));
+  EXPECT_EQ(0, sum.get(Utility::Event::MeanRatioEvaluation));
+  const auto difference = sum - second;
+  EXPECT_EQ(3, difference.get(Utility::Event::NodeReset));
+  EXPECT_TRUE((sum - sum).isZero());
+}
+
+TEST(EventCounts, getEventName) {
+  std::set<std::string_view> eventNames;
+  for (std::size_t eventIndex = 0; eventIndex < Utility::numberOfEvents;
+       ++eventIndex) {
+    eventNames.insert(
+        Utility::getEventName(static_cast<Utility::Event>(eventIndex)));
+  }
+  EXPECT_EQ(Utility::numberOfEvents, eventNames.size());
+  EXPECT_FALSE(eventNames.contains(""));
+}
+
+TEST(EventCounts, countEvent) {
+  const auto initialEventCounts = Utility::getEventCounts();
+  Utility::countEvent(Utility::Event::RepeatedSelection);
+  // Counts of terminated threads are retained.
+  std::thread thread([]() {
+    Utility::countEvent(Utility::Event::RepeatedSelection, 2);
+    Utility::countEvent(Utility::Event::RejectedSequentialStep);
+  });
+  thread.join();
+
+  const auto eventCounts = Utility::getEventCounts() - initialEventCounts;
+  if constexpr (Utility::areEventCountersEnabled) {
+    EXPECT_EQ(3, eventCounts.get(Utility::Event::RepeatedSelection));
+    EXPECT_EQ(1, eventCounts.get(Utility::Event::RejectedSequentialStep));
+    EXPECT_EQ(0, eventCounts.get(Utility::Event::NodeReset));
+  } else {
+    EXPECT_TRUE(eventCounts.isZero());
+  }
+}
@@ -0,0 +1,75 @@
+/*
+Unit tests for hardware performance counters.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/hardware_counters.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+TEST(HardwareCounterValues, arithmetic) {
+  using Utility::HardwareCounter;
+  Utility::HardwareCounterValues earlierValues;
+  EXPECT_TRUE(earlierValues.isEmpty());
+  earlierValues.set(HardwareCounter::Cycles, 10);
+  earlierValues.set(HardwareCounter::Instructions, 20);
+  EXPECT_FALSE(earlierValues.isEmpty());
+
+  Utility::HardwareCounterValues values;
+  values.set(HardwareCounter::Cycles, 15);
+  values.set(HardwareCounter::Instructions, 40);
+  values.set(HardwareCounter::CacheMisses, 5);
+  const auto difference = values - earlierValues;
+  EXPECT_EQ(5, difference.get(HardwareCounter::Cycles));
+  EXPECT_EQ(20, difference.get(HardwareCounter::Instructions));
+  EXPECT_FALSE(difference.get(HardwareCounter::CacheMisses).has_value());
+  EXPECT_FALSE(difference.get(HardwareCounter::BranchMisses).has_value());
+
+  values += earlierValues;
+  EXPECT_EQ(25, values.get(HardwareCounter::Cycles));
+  EXPECT_EQ(60, values.get(HardwareCounter::Instructions));
+  EXPECT_FALSE(values.get(HardwareCounter::CacheMisses).has_value());
+}
+
+TEST(HardwareCounters, getHardwareCounterName) {
+  EXPECT_EQ("cycles",
+            Utility::getHardwareCounterName(Utility::HardwareCounter::Cycles));
+  EXPECT_EQ("branch misses", Utility::getHardwareCounterName(
+                                 Utility::HardwareCounter::BranchMisses));
+}
+
+TEST(HardwareCounters, read) {
+  // Counters are unavailable in many environments, in which case all values
+  // have to be empty.
+  const Utility::HardwareCounters hardwareCounters;
+  double sum = 0.0;
+  for (int summand = 1; summand <= 100000; ++summand) {
+    sum += std::sqrt(static_cast<double>(summand));
+  }
+  EXPECT_GT(sum, 0.0);
+  const auto values = hardwareCounters.read();
+  EXPECT_EQ(hardwareCounters.isAvailable(), !values.isEmpty());
+  const auto& instructions =
+      values.get(Utility::HardwareCounter::Instructions);
+  if (instructions.has_value()) {
+    EXPECT_GT(instructions.value(), 100000);
+  }
+}
@@ -0,0 +1,67 @@
+/*
+Unit tests for heap memory usage of standard containers.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/memory_usage.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+TEST(MemoryUsage, arithmetic) {
+  Utility::MemoryUsage memoryUsage{100, 40};
+  EXPECT_EQ(60, memoryUsage.getOverheadBytes());
+  memoryUsage += {20, 10};
+  EXPECT_EQ(120, memoryUsage.bytes);
+  EXPECT_EQ(50, memoryUsage.payloadBytes);
+  const auto sum = memoryUsage + Utility::MemoryUsage{1, 1};
+  EXPECT_EQ(121, sum.bytes);
+  EXPECT_EQ(51, sum.payloadBytes);
+}
+
+TEST(MemoryUsage, getMemoryUsageOfVector) {
+  std::vector<std::uint32_t> values(10, 0);
+  values.reserve(20);
+  const auto memoryUsage = Utility::getMemoryUsage(values);
+  EXPECT_EQ(values.capacity() * sizeof(std::uint32_t), memoryUsage.bytes);
+  EXPECT_EQ(40, memoryUsage.payloadBytes);
+
+  const std::vector<bool> flags(17, false);
+  const auto flagsMemoryUsage = Utility::getMemoryUsage(flags);
+  EXPECT_EQ(3, flagsMemoryUsage.payloadBytes);
+  EXPECT_GE(flagsMemoryUsage.bytes, flagsMemoryUsage.payloadBytes);
+}
+
+TEST(MemoryUsage, getMemoryUsageOfUnorderedSet) {
+  const std::unordered_set<std::size_t> emptySet;
+  EXPECT_EQ(0, Utility::getMemoryUsage(emptySet).payloadBytes);
+
+  const std::unordered_set<std::size_t> set{1, 2, 3};
+  const auto memoryUsage = Utility::getMemoryUsage(set);
+  EXPECT_EQ(3 * sizeof(std::size_t), memoryUsage.payloadBytes);
+  EXPECT_GE(memoryUsage.bytes, 3 * (sizeof(void*) + sizeof(std::size_t))
+                                   + set.bucket_count() * sizeof(void*));
+
+  const std::vector<std::unordered_set<std::size_t>> sets{set, set};
+  const auto setsMemoryUsage = Utility::getMemoryUsage(sets);
+  EXPECT_EQ(2 * memoryUsage.payloadBytes, setsMemoryUsage.payloadBytes);
+  EXPECT_EQ(2 * (memoryUsage.bytes + sizeof(std::unordered_set<std::size_t>)),
+            setsMemoryUsage.bytes);
+}
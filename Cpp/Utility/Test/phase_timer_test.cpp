@@ -0,0 +1,101 @@
+/*
+Unit tests for scoped phase timers.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/phase_timer.h"
+
+#include "gtest/gtest.h"
+
+TEST(PhaseTimes, add) {
+  Utility::PhaseTimes phaseTimes;
+  EXPECT_TRUE(phaseTimes.isEmpty());
+  phaseTimes.add("transformation", 1.0);
+  phaseTimes.add("node update", 0.5);
+  phaseTimes.add("transformation", 2.0);
+  const auto& phases = phaseTimes.getPhases();
+  ASSERT_EQ(2, phases.size());
+  EXPECT_EQ("transformation", phases.at(0).name);
+  EXPECT_DOUBLE_EQ(3.0, phases.at(0).timeInSeconds);
+  EXPECT_EQ("node update", phases.at(1).name);
+  EXPECT_DOUBLE_EQ(0.5, phases.at(1).timeInSeconds);
+
+  Utility::PhaseTimes combinedPhaseTimes;
+  combinedPhaseTimes.add("node update", 1.0);
+  combinedPhaseTimes.add(phaseTimes, "");
+  combinedPhaseTimes.add(phaseTimes, "first ");
+  const auto& combinedPhases = combinedPhaseTimes.getPhases();
+  ASSERT_EQ(4, combinedPhases.size());
+  EXPECT_EQ("node update", combinedPhases.at(0).name);
+  EXPECT_DOUBLE_EQ(1.5, combinedPhases.at(0).timeInSeconds);
+  EXPECT_EQ("transformation", combinedPhases.at(1).name);
+  EXPECT_EQ("first transformation", combinedPhases.at(2).name);
+  EXPECT_DOUBLE_EQ(3.0, combinedPhases.at(2).timeInSeconds);
+  EXPECT_EQ("first node update", combinedPhases.at(3).name);
+}
+
+TEST(PhaseTimes, addToSlot) {
+  Utility::PhaseTimes phaseTimes;
+  phaseTimes.add("transformation", 1.0);
+  Utility::PhaseSlot nodeUpdatePhase("node update");
+  Utility::PhaseSlot transformationPhase("transformation");
+  phaseTimes.add(nodeUpdatePhase, 0.5);
+  phaseTimes.add(transformationPhase, 2.0);
+  phaseTimes.add(nodeUpdatePhase, 1.5);
+  ASSERT_TRUE(nodeUpdatePhase.index.has_value());
+  EXPECT_EQ(1, *nodeUpdatePhase.index);
+  ASSERT_TRUE(transformationPhase.index.has_value());
+  EXPECT_EQ(0, *transformationPhase.index);
+  const auto& phases = phaseTimes.getPhases();
+  ASSERT_EQ(2, phases.size());
+  EXPECT_EQ("transformation", phases.at(0).name);
+  EXPECT_DOUBLE_EQ(3.0, phases.at(0).timeInSeconds);
+  EXPECT_EQ("node update", phases.at(1).name);
+  EXPECT_DOUBLE_EQ(2.0, phases.at(1).timeInSeconds);
+}
+
+TEST(ScopedPhaseTimer, lifetime) {
+  Utility::PhaseTimes phaseTimes;
+  for (int repetition = 0; repetition < 2; ++repetition) {
+    const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, "phase");
+  }
+  if constexpr (Utility::arePhaseTimersEnabled) {
+    ASSERT_EQ(1, phaseTimes.getPhases().size());
+    EXPECT_EQ("phase", phaseTimes.getPhases().at(0).name);
+    EXPECT_GE(phaseTimes.getPhases().at(0).timeInSeconds, 0.0);
+  } else {
+    EXPECT_TRUE(phaseTimes.isEmpty());
+  }
+}
+
+TEST(ScopedPhaseTimer, slot) {
+  Utility::PhaseTimes phaseTimes;
+  Utility::PhaseSlot phaseSlot("phase");
+  for (int repetition = 0; repetition < 2; ++repetition) {
+    const Utility::ScopedPhaseTimer phaseTimer(phaseTimes, phaseSlot);
+  }
+  if constexpr (Utility::arePhaseTimersEnabled) {
+    ASSERT_EQ(1, phaseTimes.getPhases().size());
+    EXPECT_EQ("phase", phaseTimes.getPhases().at(0).name);
+    EXPECT_EQ(0, phaseSlot.index);
+  } else {
+    EXPECT_TRUE(phaseTimes.isEmpty());
+    EXPECT_FALSE(phaseSlot.index.has_value());
+  }
+}
@@ -0,0 +1,80 @@
+/*
+Unit tests for scoped tracing in the Chrome trace event format.
+
+Copyright (C) 2023  TWT GmbH Science & Innovation.
+
+This file is part of GETMe Polygonal Meshes 2D.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+*/
+#include "Utility/tracing.h"
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+std::string readTraceFile() {
+  const auto filePath =
+      std::filesystem::temp_directory_path() / "tmp_unittest_tracing.json";
+  Utility::writeChromeTrace(filePath);
+  std::ifstream infile(filePath);
+  std::stringstream content;
+  content << infile.rdbuf();
+  infile.close();
+  std::filesystem::remove(filePath);
+  return content.str();
+}
+}  // namespace
+
+TEST(Tracing, writeChromeTrace) {
+  Utility::startTracing();
+  Utility::setTraceThreadName("main");
+  {
+    const Utility::ScopedTraceSpan traceSpan("outer span");
+    const Utility::ScopedTraceSpan indexedTraceSpan("indexed span", 7);
+  }
+  std::thread thread([]() {
+    Utility::setTraceThreadName("worker");
+    const Utility::ScopedTraceSpan traceSpan("worker span");
+  });
+  thread.join();
+  Utility::stopTracing();
+  {
+    const Utility::ScopedTraceSpan traceSpan("stopped span");
+  }
+
+  const auto trace = readTraceFile();
+  EXPECT_EQ(0, trace.find("{\"traceEvents\":["));
+  EXPECT_EQ(std::string::npos, trace.find("stopped span"));
+  if constexpr (Utility::isTracingEnabled) {
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"main\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"worker\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"outer span\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"worker span\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"index\":7}"));
+  } else {
+    EXPECT_EQ(std::string::npos, trace.find("\"ph\":\"X\""));
+  }
+
+  // Restarting discards previously recorded spans.
+  Utility::startTracing();
+  Utility::stopTracing();
+  EXPECT_EQ(std::string::npos, readTraceFile().find("\"ph\":\"X\""));
+}